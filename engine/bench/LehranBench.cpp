@@ -0,0 +1,217 @@
+/*
+ * LehranBench - headless benchmark runner for the engine core.
+ *
+ * Builds against LehranCore without creating a window or renderer, so it
+ * runs in CI. Each workload is repeated a fixed number of times and
+ * reported as ns/op with min and median, which is what performance PRs
+ * should quote as before/after numbers.
+ *
+ * Usage: LehranBench [map_file]
+ *   map_file defaults to maps/Battle/test_map.json and is resolved
+ *   against the working directory (run from the runtime folder).
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "DamageCalculation.hpp"
+#include "EnemyStrategies.hpp"
+#include "MapManager.hpp"
+#include "SaveManager.hpp"
+#include "StringInterner.hpp"
+#include "TextureManager.hpp"
+
+namespace {
+
+// Run a workload `iterations` times and print ns/op statistics. The
+// workload runs once untimed first so lazy setup (file cache, allocator
+// warm-up) doesn't skew the first sample.
+void RunBench(const char* name, int iterations, const std::function<void()>& fn) {
+    fn();
+
+    std::vector<double> samples;
+    samples.reserve(iterations);
+
+    for (int i = 0; i < iterations; i++) {
+        auto begin = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        samples.push_back((double)std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    }
+
+    std::sort(samples.begin(), samples.end());
+    double minNs = samples.front();
+    double medianNs = samples[samples.size() / 2];
+
+    std::printf("%-24s %8d iters   min %12.0f ns/op   median %12.0f ns/op\n",
+                name, iterations, minNs, medianNs);
+}
+
+// Synthetic armies for the combat and AI workloads, deterministic so
+// numbers are comparable between runs
+void BuildArmies(std::vector<Lehran::MapUnitHot>& units,
+                 std::vector<Lehran::CombatantStats>& stats,
+                 int players, int enemies, int mapWidth) {
+    units.clear();
+    stats.clear();
+
+    for (int i = 0; i < players + enemies; i++) {
+        Lehran::MapUnitHot unit;
+        unit.isPlayer = (i < players);
+        unit.x = (i * 7 + 3) % mapWidth;
+        unit.y = (i * 11 + 5) % mapWidth;
+        unit.hp = unit.maxHp = 20 + (i % 15);
+        unit.str = 5 + (i % 10);
+        unit.skl = 4 + (i % 8);
+        unit.spd = 3 + (i % 12);
+        unit.lck = i % 9;
+        unit.def = 3 + (i % 7);
+        unit.res = 2 + (i % 6);
+        unit.con = 5 + (i % 5);
+        unit.mov = 5;
+        units.push_back(unit);
+
+        Lehran::WeaponData weapon;
+        weapon.might = 5 + (i % 6);
+        weapon.hit = 75 + (i % 20);
+        weapon.crit = i % 10;
+        weapon.weight = 4 + (i % 8);
+        weapon.type = (i % 4 == 0) ? "anima" : "sword";
+        stats.push_back(Lehran::DamageCalculation::MakeStats(unit, weapon));
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string mapFile = (argc > 1) ? argv[1] : "maps/Battle/test_map.json";
+
+    std::printf("LehranBench (headless)\n");
+    std::printf("map: %s\n\n", mapFile.c_str());
+
+    // Core systems without a window: texture uploads fail gracefully and
+    // everything else (parsing, grids, range math) runs normally
+    TextureManager textureManager(nullptr);
+    Lehran::MapManager mapManager(nullptr, &textureManager, nullptr, nullptr, nullptr, nullptr);
+
+    // --- Map loading: JSON/binary parse, unit resolution, grid builds ---
+    if (mapManager.LoadMap(mapFile)) {
+        RunBench("map_load", 10, [&]() {
+            mapManager.LoadMap(mapFile);
+        });
+
+        // --- Range math: select every player unit through the public
+        // cursor path, which runs the Dijkstra movement flood, the attack
+        // range BFS, and the path backtrace ---
+        int width = mapManager.GetMapWidth();
+        int height = mapManager.GetMapHeight();
+        RunBench("range_all_units", 20, [&]() {
+            for (int y = 0; y < height; y++) {
+                for (int x = 0; x < width; x++) {
+                    mapManager.SetCursorPosition(x, y);
+                    mapManager.SelectUnit();
+                    mapManager.CancelSelection();
+                }
+            }
+        });
+    } else {
+        std::printf("map not found - skipping map_load and range_all_units\n");
+    }
+
+    // --- Damage forecast kernel over a flat batch ---
+    {
+        std::vector<Lehran::MapUnitHot> units;
+        std::vector<Lehran::CombatantStats> stats;
+        BuildArmies(units, stats, 512, 512, 64);
+
+        std::vector<Lehran::CombatantStats> attackers(stats.begin(), stats.begin() + 512);
+        std::vector<Lehran::CombatantStats> defenders(stats.begin() + 512, stats.end());
+        std::vector<Lehran::CombatForecast> forecasts(512);
+
+        RunBench("forecast_batch_512", 1000, [&]() {
+            Lehran::DamageCalculation::ForecastBatch(attackers.data(), defenders.data(),
+                                                     forecasts.data(), forecasts.size());
+        });
+    }
+
+    // --- AI evaluation: a full enemy phase decision over a synthetic map ---
+    {
+        const int mapSize = 40;
+        std::vector<Lehran::MapUnitHot> units;
+        std::vector<Lehran::CombatantStats> stats;
+        BuildArmies(units, stats, 10, 20, mapSize);
+
+        Lehran::EnemyPhaseView view;
+        view.width = mapSize;
+        view.height = mapSize;
+        view.tileCost.assign(mapSize * mapSize, 1);
+        view.occupancy.assign(mapSize * mapSize, -1);
+        for (int i = 0; i < (int)units.size(); i++) {
+            view.occupancy[units[i].y * mapSize + units[i].x] = i;
+        }
+        std::vector<int> ranges(units.size(), 2);
+
+        RunBench("enemy_phase_decide", 50, [&]() {
+            Lehran::EnemyStrategies::DecidePhase(view, units, stats, ranges);
+        });
+    }
+
+    // --- Save round-trip with a maxed save ---
+    {
+        Lehran::SaveManager saveManager;
+        saveManager.set_project_subdirectory("LehranBench");
+
+        Lehran::SaveData data;
+        data.slot_name = "Bench - Chapter 30";
+        data.current_chapter = 30;
+        data.turn_count = 99;
+        data.gold = 99999;
+        data.is_mid_battle = true;
+        data.current_map = "maps/Battle/test_map.json";
+
+        for (int i = 0; i < 50; i++) {
+            Lehran::UnitSaveData unit;
+            unit.character_id = Lehran::StringInterner::Intern("0000" + std::to_string(1000 + i));
+            unit.unit_name = "Unit " + std::to_string(i);
+            unit.class_name = Lehran::StringInterner::Intern("Myrmidon");
+            unit.level = 20;
+            unit.experience = 99;
+            unit.hp_current = unit.hp_max = 60;
+            unit.is_alive = true;
+            unit.is_recruited = true;
+            for (int j = 0; j < 5; j++) {
+                Lehran::ItemData item;
+                item.item_id = Lehran::StringInterner::Intern("iron_sword");
+                item.uses_remaining = 46;
+                item.is_equipped = (j == 0);
+                unit.inventory.push_back(item);
+            }
+            data.units.push_back(unit);
+            data.unit_positions.push_back({unit.character_id, {i % 20, i / 20}});
+        }
+        for (int i = 0; i < 200; i++) {
+            data.event_flags[Lehran::StringInterner::Intern("flag_" + std::to_string(i))] = (i % 2 == 0);
+            data.variables[Lehran::StringInterner::Intern("var_" + std::to_string(i))] = i * 3;
+        }
+        for (int i = 0; i < 100; i++) {
+            Lehran::ItemData item;
+            item.item_id = Lehran::StringInterner::Intern("convoy_item_" + std::to_string(i % 12));
+            item.uses_remaining = i % 40;
+            data.convoy.push_back(item);
+        }
+
+        RunBench("save_load_roundtrip", 50, [&]() {
+            saveManager.save(data, 0);
+            Lehran::SaveData loaded;
+            saveManager.load(0, loaded);
+        });
+
+        saveManager.delete_slot(0);
+    }
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <SDL.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class TextureManager;
+
+// Background asset loader. A worker thread does the file I/O and IMG_Load
+// into plain surfaces; the main thread drains the results in Update() and
+// hands them to TextureManager, which uploads to SDL_Texture under a small
+// per-frame budget. Maps can be queued ahead of time (QueueMapPreload) so
+// the next chapter's tiles, sprites and music stream in while the player
+// is still on the previous screen, and loading screens can poll
+// GetProgress() instead of stalling.
+class AssetStreamer {
+private:
+    struct LoadedAsset {
+        std::string path;
+        SDL_Surface* surface;  // Null for non-image files (cache warm-up only)
+    };
+
+    TextureManager* textureManager;
+
+    std::thread worker;
+    std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    std::deque<std::string> pendingPaths;
+    bool running;
+
+    std::mutex doneMutex;
+    std::vector<LoadedAsset> doneAssets;
+
+    std::atomic<int> totalQueued;
+    std::atomic<int> totalFinished;
+
+    void WorkerLoop();
+    static bool IsImagePath(const std::string& path);
+
+public:
+    explicit AssetStreamer(TextureManager* textureManager);
+    ~AssetStreamer();
+
+    // Queue a single file for background loading
+    void QueueFile(const std::string& path);
+
+    // Parse a map file and queue everything it will need: the atlas tile
+    // textures, unit sprites, map music and any explicit "preload" list
+    bool QueueMapPreload(const std::string& mapFile);
+
+    // Call once per frame on the main thread: moves finished surfaces into
+    // TextureManager and uploads at most maxUploads of them to the GPU
+    void Update(int maxUploads = 2);
+
+    // Progress query for loading screens
+    bool IsIdle() const { return totalFinished.load() >= totalQueued.load(); }
+    float GetProgress() const;
+};
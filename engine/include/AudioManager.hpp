@@ -0,0 +1,79 @@
+#pragma once
+
+#include <SDL_mixer.h>
+#include "json.hpp"
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+using json = nlohmann::json;
+
+// Central audio system. Sound effects are decoded once at startup into a
+// pooled Mix_Chunk table and played by id, so hot paths like cursor
+// movement never touch the disk or allocate. Music transitions hand the
+// file load to a background thread: the main thread keeps rendering,
+// Update() picks up the decoded track, fades the old one out and the new
+// one in, so scene/map switches no longer hitch. All playback calls stay
+// on the main thread; the worker only loads.
+class AudioManager {
+private:
+    bool audioAvailable;
+
+    // SFX pool, decoded up front
+    std::unordered_map<std::string, Mix_Chunk*> sfxPool;
+
+    // Currently playing music
+    Mix_Music* currentMusic;
+    std::string currentMusicPath;
+
+    // Music the main thread wants; the worker loads the most recent one
+    std::string targetPath;
+
+    std::thread worker;
+    std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    std::string requestedPath;  // Next path for the worker, empty = idle
+    bool running;
+
+    // Finished load waiting for the main thread
+    std::mutex doneMutex;
+    Mix_Music* loadedMusic;
+    std::string loadedPath;
+
+    // Decoded track waiting for the outgoing music to finish fading
+    Mix_Music* queuedMusic;
+    std::string queuedPath;
+    bool fadingOut;
+    int crossfadeMs;
+
+    void WorkerLoop();
+
+public:
+    explicit AudioManager(bool audioAvailable);
+    ~AudioManager();
+
+    // Decode the engine's built-in sounds plus everything listed under
+    // "sfx" in audio_assignments.json into the pool
+    void PreloadSFX(const json& audioAssignments);
+
+    // Add one sound to the pool (id -> file); returns false on failure
+    bool LoadSFX(const std::string& id, const std::string& path);
+
+    // Play a pooled sound on the first free channel. Unknown ids are a
+    // quiet no-op so missing assets never crash gameplay code.
+    void PlaySFX(const std::string& id);
+
+    // Switch music to the given file with a crossfade. Returns
+    // immediately; the load happens on the worker thread. Requesting the
+    // track that is already playing does nothing.
+    void PlayMusic(const std::string& path, int fadeMs = 600);
+    void StopMusic(int fadeMs = 600);
+
+    // Call once per frame on the main thread: collects finished loads and
+    // drives the fade-out/fade-in handover
+    void Update();
+
+    const std::string& GetCurrentMusicPath() const { return currentMusicPath; }
+};
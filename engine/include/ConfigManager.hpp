@@ -19,6 +19,8 @@ struct DisplaySettings {
     int nativeDisplayHeight;
     float renderScale;
     int selectedResolutionIndex;
+    int fpsCap;        // Max frames per second; 0 = uncapped (vsync only)
+    int textureBudgetMB;  // Texture cache memory budget in MB; 0 = unlimited
 };
 
 struct AudioSettings {
@@ -28,6 +30,11 @@ struct AudioSettings {
     int voiceVolume;   // 0-100
 };
 
+struct InputSettings {
+    int cursorInitialDelayTicks;  // Fixed-step ticks a direction is held before it repeats
+    int cursorRepeatTicks;        // Ticks between repeats once repeating
+};
+
 class ConfigManager {
 public:
     ConfigManager();
@@ -50,6 +57,10 @@ public:
     int GetNativeDisplayHeight() const { return displaySettings.nativeDisplayHeight; }
     float GetRenderScale() const { return displaySettings.renderScale; }
     int GetResolutionIndex() const { return displaySettings.selectedResolutionIndex; }
+    void SetFPSCap(int cap);
+    int GetFPSCap() const { return displaySettings.fpsCap; }
+    void SetTextureBudgetMB(int megabytes);
+    int GetTextureBudgetMB() const { return displaySettings.textureBudgetMB; }
 
     // Audio settings
     const AudioSettings& GetAudioSettings() const { return audioSettings; }
@@ -63,6 +74,11 @@ public:
     int GetSFXVolume() const { return audioSettings.sfxVolume; }
     int GetVoiceVolume() const { return audioSettings.voiceVolume; }
 
+    // Input settings
+    const InputSettings& GetInputSettings() const { return inputSettings; }
+    int GetCursorInitialDelayTicks() const { return inputSettings.cursorInitialDelayTicks; }
+    int GetCursorRepeatTicks() const { return inputSettings.cursorRepeatTicks; }
+
     // Resolution helpers
     void CycleResolutionForward();
     void CycleResolutionBackward();
@@ -71,6 +87,7 @@ public:
 private:
     DisplaySettings displaySettings;
     AudioSettings audioSettings;
+    InputSettings inputSettings;
 
     void CalculateRenderScale();
 };
@@ -3,6 +3,7 @@
 #include <SDL.h>
 #include <SDL_ttf.h>
 #include "TextureManager.hpp"
+#include "TextCache.hpp"
 #include <string>
 #include <vector>
 
@@ -28,7 +29,8 @@ private:
     TTF_Font* fontMedium;
     TTF_Font* fontSmall;
     TextureManager* textureManager;
-    
+    Lehran::TextCache* textCache;
+
     std::vector<DialogueLine> dialogueLines;
     int currentLineIndex;
     bool isActive;
@@ -49,14 +51,47 @@ private:
     static const int DIALOGUE_BOX_HEIGHT = 270;
     static const int DIALOGUE_BOX_Y = 810;
     static const int PORTRAIT_SIZE = 216;
-    
+    static const int TEXT_MAX_WIDTH = 1400;
+
+    // Render cache. Lines are wrapped once in LoadDialogue() and each
+    // wrapped row is rasterized once when its line comes up; the
+    // typewriter reveal then crops the row texture with a source rect
+    // against precomputed prefix widths, so advancing a character costs
+    // rect math instead of re-measuring and re-rasterizing every frame.
+    struct RowCache {
+        std::string text;
+        SDL_Texture* texture = nullptr;  // Owned by DialogueSystem
+        int width = 0;
+        int height = 0;
+        size_t revealStart = 0;          // Index of the row's first char in the full line
+        std::vector<int> prefixWidths;   // prefixWidths[n] = pixel width of the first n chars
+    };
+    struct ChoiceCache {
+        SDL_Texture* normal = nullptr;   // Both owned by DialogueSystem
+        SDL_Texture* selected = nullptr;
+        int width = 0;
+        int height = 0;
+    };
+    std::vector<std::vector<std::string>> wrappedCache;  // Pre-wrapped rows per dialogue line
+    std::vector<RowCache> rowCache;                      // Rows of the line being shown
+    SDL_Texture* speakerTexture;
+    int speakerWidth, speakerHeight;
+    std::vector<ChoiceCache> choiceCache;
+    int cachedLineIndex;                                 // Line rowCache was built for, -1 = none
+
     void RenderText(const std::string& text, int x, int y, TTF_Font* font, SDL_Color color, bool centered = false);
     std::vector<std::string> WrapText(const std::string& text, TTF_Font* font, int maxWidth);
-    
+    SDL_Texture* CreateTextTexture(const std::string& text, TTF_Font* font, SDL_Color color, int& width, int& height);
+    void BuildLineCache();
+    void ClearLineCache();
+    void ClearChoiceCache();
+
 public:
-    DialogueSystem(SDL_Renderer* renderer, TTF_Font* fontMedium, 
-                   TTF_Font* fontSmall, TextureManager* textureManager);
-    
+    DialogueSystem(SDL_Renderer* renderer, TTF_Font* fontMedium,
+                   TTF_Font* fontSmall, TextureManager* textureManager,
+                   Lehran::TextCache* textCache);
+    ~DialogueSystem();
+
     // Load dialogue from a vector
     void LoadDialogue(const std::vector<DialogueLine>& lines);
     
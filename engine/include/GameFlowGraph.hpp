@@ -0,0 +1,69 @@
+#pragma once
+
+#include "DialogueSystem.hpp"
+#include "json.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace Lehran {
+
+/**
+ * One compiled scene: everything LoadScene used to pull out of the scene
+ * JSON at transition time, resolved up front. Dialogue lines are fully
+ * parsed, paths carry their asset prefixes, and the next scene is an
+ * index into the node array instead of a string to re-resolve.
+ */
+struct GameFlowNode {
+    uint32_t sceneId;       // Interned scene id (StringInterner)
+    std::string background; // Full path ("assets/..."), empty = none
+    std::string music;      // Music file relative to assets/, empty = none
+    int nextNode;           // Index of the following node, -1 = return to title
+    std::vector<DialogueSystem::DialogueLine> dialogue;
+
+    GameFlowNode() : sceneId(0), nextNode(-1) {}
+};
+
+/**
+ * The game flow compiled into a dense node graph at startup. Compile
+ * walks every scene reachable from game_flow.json, loads and parses each
+ * scene file exactly once, and probes every referenced asset file, so a
+ * typo in the flow or a scene is a startup error instead of a mid-game
+ * hitch. After that, state transitions are integer index hops with no
+ * file I/O and no JSON traversal.
+ */
+class GameFlowGraph {
+public:
+    GameFlowGraph() : startNode(-1) {}
+
+    /**
+     * Compile the graph from the raw game_flow.json document. Returns
+     * false (leaving the graph empty) if any reachable scene file is
+     * missing or malformed, or any referenced asset does not exist;
+     * every problem found is reported, not just the first.
+     */
+    bool Compile(const json& gameFlow);
+
+    bool IsValid() const { return startNode >= 0; }
+    int GetStartNode() const { return startNode; }
+
+    // Node index for a scene id, -1 if the id is not in the graph
+    int FindNode(const std::string& sceneId) const;
+
+    const GameFlowNode& GetNode(int index) const { return nodes[index]; }
+    int GetNodeCount() const { return (int)nodes.size(); }
+
+private:
+    std::vector<GameFlowNode> nodes;
+    std::unordered_map<uint32_t, int> nodeIndex;  // Interned scene id -> node
+    int startNode;
+
+    // Load + parse one scene file into a node; returns its index or -1.
+    // errors counts problems so Compile can report them all.
+    int CompileScene(const std::string& sceneId, int& errors);
+};
+
+} // namespace Lehran
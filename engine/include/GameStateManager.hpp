@@ -15,6 +15,7 @@ class SaveSlotScreen;
 namespace Lehran {
 
 class SaveManager;
+class GameFlowGraph;
 
 class GameStateManager {
 public:
@@ -45,9 +46,13 @@ public:
     void UpdateSplashTimer(float deltaTime);
     bool ShouldTransitionFromSplash() const { return splashTimer >= 3.5f; }
 
-    // Scene management
-    void StartGameFromSlot(int slotNumber, SaveManager* saveManager, const json& gameFlow);
+    // Scene management. Transitions walk the compiled flow graph with
+    // integer node indices; LoadScene falls back to loading the scene
+    // file directly only for scenes outside the graph (dev/test menu).
+    void SetGameFlow(const GameFlowGraph* graph) { flowGraph = graph; }
+    void StartGameFromSlot(int slotNumber, SaveManager* saveManager);
     void LoadScene(const std::string& sceneId, SceneManager* sceneManager, DialogueSystem* dialogueSystem);
+    void LoadNode(int nodeIndex, SceneManager* sceneManager, DialogueSystem* dialogueSystem);
     void EndScene(SceneManager* sceneManager, DialogueSystem* dialogueSystem);
     const std::string& GetCurrentSceneId() const { return currentSceneId; }
 
@@ -74,6 +79,8 @@ private:
     int currentSaveSlot;
     
     // Scene management
+    const GameFlowGraph* flowGraph;  // Compiled at startup, owned by the engine
+    int currentNodeIndex;            // Node being played, -1 = off-graph scene
     std::string currentSceneId;
     
     // Callbacks
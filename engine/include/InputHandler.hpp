@@ -33,9 +33,16 @@ public:
     InputHandler();
     ~InputHandler();
 
-    // Main input processing
+    // Main input processing. Discrete actions (confirm/cancel/menus) are
+    // event-driven through HandleKeyDown; held cursor/camera movement is
+    // polled from the keyboard state once per fixed-timestep tick so it
+    // repeats at our rate, not the OS key-repeat rate.
     void HandleKeyDown(SDL_Keycode key, GameState currentState);
     void HandleMouseWheel(int wheelY, GameState currentState);
+    void PollHeldKeys(GameState currentState);
+
+    // Held-key repeat timing, in fixed-timestep ticks
+    void SetCursorRepeat(int initialDelayTicks, int repeatTicks);
 
     // Set callbacks
     void SetStateChangeCallback(StateChangeCallback callback) { onStateChange = callback; }
@@ -49,6 +56,7 @@ public:
     void SetMapActionMenuCallback(std::function<int(int)> callback) { onMapActionMenuAction = callback; }
     void SetMapInventoryCallback(std::function<int(int)> callback) { onMapInventoryAction = callback; }
     void SetMapToggleUnitInfoCallback(std::function<void()> callback) { onMapToggleUnitInfo = callback; }
+    void SetMapToggleDangerZoneCallback(std::function<void()> callback) { onMapToggleDangerZone = callback; }
 
     // Set external systems for input forwarding
     void SetSaveSlotScreen(SaveSlotScreen* screen) { saveSlotScreen = screen; }
@@ -90,6 +98,14 @@ private:
     std::function<int(int)> onMapActionMenuAction;  // Query/navigate action menu
     std::function<int(int)> onMapInventoryAction;   // Query/navigate inventory
     std::function<void()> onMapToggleUnitInfo;      // Toggle unit info panel
+    std::function<void()> onMapToggleDangerZone;    // Toggle enemy danger zone overlay
+
+    // Held-key repeat state for the polled cursor path
+    int cursorInitialDelayTicks;
+    int cursorRepeatTicks;
+    int heldDX;         // Direction sampled last tick (0 when released)
+    int heldDY;
+    int heldTicks;      // Ticks the current direction has been held
 
     // External systems
     SaveSlotScreen* saveSlotScreen;
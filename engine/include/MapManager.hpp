@@ -1,17 +1,23 @@
 #pragma once
 
 #include <SDL.h>
-#include <SDL_mixer.h>
 #include <SDL_ttf.h>
 #include "TextureManager.hpp"
+#include "TextCache.hpp"
 #include "json.hpp"
+#include <functional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 using json = nlohmann::json;
 
+class AudioManager;
+
 namespace Lehran {
 
+struct SaveData;
+
 struct TileType {
     int id;
     std::string name;
@@ -20,10 +26,10 @@ struct TileType {
     int moveCost;
     int avoidBonus;
     int defenseBonus;
-    SDL_Texture* texture;
-    
-    TileType() : id(0), passable(true), moveCost(1), avoidBonus(0), 
-                 defenseBonus(0), texture(nullptr) {}
+    TextureManager::AtlasRegion atlas;
+
+    TileType() : id(0), passable(true), moveCost(1), avoidBonus(0),
+                 defenseBonus(0) {}
 };
 
 struct MapLayer {
@@ -50,30 +56,54 @@ struct WeaponData {
     WeaponData() : might(0), hit(0), crit(0), weight(0), durability(0), isPRF(false) {}
 };
 
-struct MapUnit {
-    std::string type;        // "player" or "enemy"
-    std::string unitId;      // ID to lookup in units.json
-    std::string name;        // Unit name from data
-    std::string className;   // Class name from data
-    int level;               // Current level
-    std::string spritePath;
+struct ClassData {
+    std::string id;
+    std::string name;                      // Display name
+    std::vector<std::string> weaponTypes;  // Wieldable weapon type keys
+};
+
+// Unit storage is split hot/cold with shared indices: the hot array holds
+// the per-frame data (position, stats, flags, atlas handle) the render
+// loop and batch combat/AI queries iterate, while strings and inventory
+// live in the parallel cold array so hot iteration never drags string
+// headers through cache.
+// Marks a unit with no shared frame table (sprite failed to load)
+static const uint16_t SPRITE_ANIM_NONE = 0xFFFF;
+
+struct MapUnitHot {
     int x, y;                // Grid position
-    
+    int level;               // Current level
+
     // Stats
     int hp, maxHp;
     int str, mag, skl, spd, lck, def, res, con, mov;
-    
-    // Inventory
-    std::vector<std::string> inventory;  // Item IDs
-    int equippedItemIndex;               // Index of equipped item, -1 if none
-    
+
+    int equippedItemIndex;   // Index into MapUnitCold::inventory, -1 if none
+
     // State
+    bool isPlayer;           // Cached from MapUnitCold::type
     bool hasMoved;           // Has unit moved this turn
-    SDL_Texture* texture;
-    
-    MapUnit() : x(0), y(0), level(1), hp(20), maxHp(20), 
-                str(5), mag(5), skl(5), spd(5), lck(5), def(5), res(5), con(5), mov(5),
-                equippedItemIndex(-1), hasMoved(false), texture(nullptr) {}
+    TextureManager::AtlasRegion sprite;  // Static fallback frame (frame 0)
+
+    // Animation state: handle into MapManager's shared frame tables plus
+    // the per-unit counters the batch advance loop touches
+    uint16_t animHandle;
+    uint8_t animFrame;       // Current frame within the table
+    uint8_t animTicks;       // Fixed-step ticks spent on this frame
+
+    MapUnitHot() : x(0), y(0), level(1), hp(20), maxHp(20),
+                   str(5), mag(5), skl(5), spd(5), lck(5), def(5), res(5), con(5), mov(5),
+                   equippedItemIndex(-1), isPlayer(false), hasMoved(false),
+                   animHandle(SPRITE_ANIM_NONE), animFrame(0), animTicks(0) {}
+};
+
+struct MapUnitCold {
+    std::string type;        // "player" or "enemy"
+    std::string unitId;      // ID to lookup in units.json
+    std::string name;        // Unit name from data
+    std::string className;   // Class name from data
+    std::string spritePath;
+    std::vector<uint32_t> inventory;     // Interned item-ID handles (StringInterner)
 };
 
 class MapManager {
@@ -82,23 +112,65 @@ private:
     TextureManager* textureManager;
     class ConfigManager* configManager;
     TTF_Font* font;
+    TextCache* textCache;
+    AudioManager* audioManager;
     
     // Atlas data
     std::string atlasPath;
     int tileSize;
     std::vector<TileType> tileTypes;
+    std::vector<int> tileTypeLookup;  // Dense tile ID -> index into tileTypes, -1 = unknown
     
     // Map data
     std::string mapName;
     std::string mapMusic;
+    std::string mapFilePath;  // Path the current map was loaded from
     int mapWidth;
     int mapHeight;
+    int turnNumber;           // 1-based, advances after each enemy phase
+    std::function<void()> onTurnEnd;  // Fired after each enemy phase (autosave hook)
     std::vector<MapLayer> layers;
-    std::vector<MapUnit> units;
+    std::vector<MapUnitHot> unitsHot;    // Parallel arrays, same index = same unit
+    std::vector<MapUnitCold> unitsCold;
+    std::vector<int> occupancyGrid;  // Unit index per tile, -1 = empty; kept in sync as units move
+
+    // Sprite animation: frames are src rects into the shared atlas, one
+    // table per sprite sheet, shared by every unit using that sheet. A
+    // sheet whose width is an integral multiple of its height is treated
+    // as a horizontal strip of square frames; anything else is a single
+    // static frame. Units only store a handle + frame counter, so
+    // advancing all animations is one pass over the hot array with zero
+    // texture work.
+    struct SpriteFrames {
+        std::vector<TextureManager::AtlasRegion> frames;
+    };
+    static const int ANIM_TICKS_PER_FRAME = 20;  // 60Hz steps per frame (~3 fps bounce)
+    std::vector<SpriteFrames> animTable;
+    std::unordered_map<std::string, uint16_t> animIndexBySheet;
+
+    uint16_t LoadSpriteFrames(const std::string& spritePath);
+
+    // Static layer cache: the tile layers baked into render-target chunk
+    // textures so a frame costs a few SDL_RenderCopy calls instead of one
+    // draw per tile. Rebuilt lazily whenever the map or atlas changes.
+    static const int CHUNK_TILES = 16;   // Chunk edge length in tiles
+    std::vector<SDL_Texture*> staticChunks;  // Row-major chunk grid, empty if baking unavailable
+    int chunkCols;
+    int chunkRows;
+    bool staticLayersDirty;
     
-    // Weapon and class data
-    json weaponsData;
-    json classesData;
+    // Weapon and class databases. The JSON documents are parsed exactly
+    // once at map load into these dense tables; hot code resolves an id
+    // to a 16-bit handle through the index maps and reads the tables by
+    // reference instead of re-searching the JSON per call.
+    static const uint16_t WEAPON_HANDLE_NONE = 0xFFFF;
+    std::vector<WeaponData> weaponTable;
+    std::unordered_map<std::string, uint16_t> weaponIndex;     // Weapon id -> weaponTable slot
+    std::unordered_map<uint32_t, uint16_t> weaponIndexByItem;  // Interned item handle -> weaponTable slot
+    std::vector<ClassData> classTable;
+    std::unordered_map<std::string, uint16_t> classIndex;      // Class id -> classTable slot
+    std::unordered_map<std::string, uint16_t> classNameIndex;  // Display name -> classTable slot
+    mutable WeaponData unknownWeapon;  // Fallback for ids missing from the table
     
     // Camera
     int cameraX;
@@ -110,16 +182,16 @@ private:
     // Cursor
     int cursorX;
     int cursorY;
-    SDL_Texture* cursorTexture;
-    Mix_Chunk* cursorSound;
+    TextureManager::AtlasRegion cursorMarker;
     bool showCursor;
     
     // Unit selection and movement
     int selectedUnitIndex;   // Index of selected unit, -1 if none
-    std::vector<std::pair<int, int>> moveRangeTiles;  // Tiles within move range
-    std::vector<std::pair<int, int>> attackRangeTiles; // Tiles within attack range
-    SDL_Texture* moveRangeTexture;
-    SDL_Texture* attackRangeTexture;
+    std::vector<int> moveCostGrid;   // Per-tile movement cost from selected unit, -1 = unreachable (reused between selections)
+    std::vector<uint8_t> attackRangeGrid;  // 1 = attackable but not reachable (reused between selections)
+    std::vector<int> movePath;       // Tile indices from selected unit to cursor, updated per cursor move
+    TextureManager::AtlasRegion moveRangeMarker;
+    TextureManager::AtlasRegion attackRangeMarker;
     
     // Action menu after movement
     bool showActionMenu;
@@ -132,35 +204,90 @@ private:
     int selectedInventoryIndex;
     int inventoryUnitIndex;  // Unit whose inventory is being shown
     bool showDropConfirmation;  // Showing confirmation dialog for dropping
-    std::vector<std::string> originalInventory;  // Backup for cancellation
+    std::vector<uint32_t> originalInventory;  // Backup for cancellation
     int originalEquippedIndex;  // Backup equipped index
     
     // Unit info panel
     bool showUnitInfo;
     int unitInfoIndex;  // Unit whose info is being shown
+
+    // Danger zone overlay: one threat bitset per unit merged into a
+    // per-tile counter grid. Only units whose position or equipment
+    // changed since the last query are recomputed, so the toggle is
+    // instant even with many enemies.
+    bool showDangerZone;
+    std::vector<std::vector<uint8_t>> threatGridPerUnit;  // 1 = tile threatened by that unit
+    std::vector<uint8_t> threatDirty;                     // 1 = recompute before next query
+    std::vector<uint16_t> dangerGrid;                     // Threatening-enemy count per tile
     
     void ClearAtlas();
     void ClearMap();
+    void ResetMapState();
+    bool LoadMapJson(const std::string& mapFile);
+    bool LoadMapBinary(const std::string& mapFile);
+    void RebuildStaticLayerCache();
+    void DestroyStaticLayerCache();
     void CalculateMovementRange();
     void CalculateAttackRange();
+    void UpdateMovePath();
+    void RenderMovePath(int scaledTileSize);
+    void MarkThreatDirty(int unitIndex);
+    void ResetDangerZone();
+    void UpdateDangerZone();
+    void ComputeUnitThreat(int unitIndex, std::vector<uint8_t>& outGrid) const;
+    const TileType* GetTileTypeById(int tileId) const;
+    const TileType* GetTerrainAt(int x, int y) const;
+    void GetVisibleTileWindow(int scaledTileSize, int& startX, int& startY, int& endX, int& endY) const;
+    void DrawMenuText(const std::string& text, int x, int y, SDL_Color color);
+    void RebuildOccupancyGrid();
+    void MoveUnitTo(int unitIndex, int x, int y);
     int GetUnitAtPosition(int x, int y) const;
-    WeaponData GetWeaponData(const std::string& weaponId) const;
-    bool CanUnitWieldWeapon(const MapUnit& unit, const WeaponData& weapon) const;
+    void BuildWeaponTable(const json& weaponsData);
+    void BuildClassTable(const json& classesData);
+    uint16_t FindWeaponHandle(const std::string& weaponId) const;
+    uint16_t FindWeaponHandle(uint32_t itemId) const;
+    const WeaponData& GetWeaponByHandle(uint16_t handle) const;
+    const WeaponData& GetWeaponData(const std::string& weaponId) const;
+    const WeaponData& GetWeaponData(uint32_t itemId) const;
+    bool CanUnitWieldWeapon(const MapUnitCold& unit, const WeaponData& weapon) const;
     std::string GetClassDisplayName(const std::string& classId) const;
     
 public:
-    MapManager(SDL_Renderer* renderer, TextureManager* textureManager, class ConfigManager* configManager, TTF_Font* font);
+    MapManager(SDL_Renderer* renderer, TextureManager* textureManager, class ConfigManager* configManager, TTF_Font* font, TextCache* textCache, AudioManager* audioManager);
     ~MapManager();
     
-    // Load atlas and map
+    // Load atlas and map. LoadMap picks the compiled binary form (.lmap)
+    // when given one, or when a compiled sibling of a JSON map exists;
+    // JSON stays the editor/debug format.
     bool LoadAtlas(const std::string& atlasFile);
     bool LoadMap(const std::string& mapFile);
+
+    // Compile a JSON map into the binary .lmap format (run offline or from
+    // dev tooling; layer data becomes raw arrays read with one block read)
+    bool CompileMapBinary(const std::string& jsonMapFile, const std::string& outFile);
     
     // Get map music
     std::string GetMapMusic() const { return mapMusic; }
+
+    // Turn tracking; the callback fires after each enemy phase so the
+    // game can autosave every turn without MapManager owning a SaveManager
+    int GetTurnNumber() const { return turnNumber; }
+    void SetTurnEndCallback(std::function<void()> callback) { onTurnEnd = callback; }
+
+    // Snapshot the current battle into a SaveData (for suspend saves and
+    // the per-turn autosave); pairs with SaveManager::save_async
+    void CaptureSaveData(SaveData& out) const;
     
+    // Fixed-step update: advances every unit's animation state in one
+    // batched pass. Call once per simulation tick while the map is active.
+    void Update(float deltaTime);
+
     // Rendering
     void Render();
+
+    // Call when tile data changes (e.g. a destroyed wall) so the baked
+    // static layers get re-rendered on the next frame
+    void InvalidateStaticLayers() { staticLayersDirty = true; }
     
     // Camera control
     void SetCamera(int x, int y);
@@ -180,6 +307,11 @@ public:
     void ConfirmMove();
     bool HasSelectedUnit() const { return selectedUnitIndex >= 0; }
     bool IsInMoveRange(int x, int y) const;
+
+    // Decide and execute every enemy's action (EnemyStrategies worker
+    // pool), then start the next player turn. Runs automatically once
+    // all player units have acted.
+    void RunEnemyPhase();
     
     // Action menu
     void MoveActionSelection(int delta);
@@ -200,6 +332,10 @@ public:
     // Unit info panel
     void ToggleUnitInfo();
     bool IsShowingUnitInfo() const { return showUnitInfo; }
+
+    // Danger zone overlay
+    void ToggleDangerZone();
+    bool IsShowingDangerZone() const { return showDangerZone; }
     
     // Getters
     std::string GetMapName() const { return mapName; }
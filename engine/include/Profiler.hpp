@@ -0,0 +1,76 @@
+#pragma once
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Lehran {
+
+class RenderManager;
+
+// Scoped-timer frame profiler for the main loop. Zones are opened with
+// Profiler::Zone on the stack, aggregated per frame, and shown on a
+// toggleable HUD (per-zone ms plus a frame-time graph). A capture mode
+// appends one CSV row per frame so builds can be diffed offline.
+class Profiler {
+private:
+    struct ZoneStats {
+        std::string name;
+        double frameMs;  // Accumulated time this frame
+    };
+
+    static const int FRAME_HISTORY = 120;
+
+    bool hudVisible;
+    bool capturing;
+    std::string capturePath;
+    std::ofstream captureFile;
+    int frameNumber;
+
+    // Zones in first-seen order so the HUD and CSV columns are stable
+    std::vector<ZoneStats> zones;
+    std::unordered_map<std::string, size_t> zoneIndex;
+
+    double frameHistory[FRAME_HISTORY];
+    int frameHistoryPos;
+    Uint64 frameStart;
+    double lastFrameMs;
+
+    size_t GetZoneIndex(const char* name);
+    void WriteCaptureHeader();
+    void WriteCaptureRow();
+
+public:
+    // RAII zone timer: accumulates into the named zone when destroyed
+    class Zone {
+    private:
+        Profiler* profiler;
+        size_t index;
+        Uint64 start;
+
+    public:
+        Zone(Profiler* profiler, const char* name);
+        ~Zone();
+    };
+
+    Profiler();
+    ~Profiler();
+
+    // Frame boundaries (call from the main loop)
+    void BeginFrame();
+    void EndFrame();
+
+    // HUD overlay; draw after the scene so it sits on top
+    void ToggleHUD() { hudVisible = !hudVisible; }
+    bool IsHUDVisible() const { return hudVisible; }
+    void RenderHUD(RenderManager* renderManager, SDL_Renderer* renderer, TTF_Font* font);
+
+    // Per-frame CSV capture for diffing builds
+    void ToggleCapture(const std::string& path = "profile.csv");
+    bool IsCapturing() const { return capturing; }
+};
+
+} // namespace Lehran
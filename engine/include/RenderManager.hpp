@@ -5,6 +5,7 @@
 #include <string>
 #include "json.hpp"
 #include "ConfigManager.hpp"
+#include "TextCache.hpp"
 
 // Forward declarations
 class SaveSlotScreen;
@@ -15,7 +16,7 @@ namespace Lehran {
 
 class RenderManager {
 public:
-    RenderManager(SDL_Renderer* renderer, TTF_Font* fontLarge, TTF_Font* fontMedium, TTF_Font* fontSmall);
+    RenderManager(SDL_Renderer* renderer, TextCache* textCache, TTF_Font* fontLarge, TTF_Font* fontMedium, TTF_Font* fontSmall);
     ~RenderManager();
 
     // Main rendering functions
@@ -34,6 +35,7 @@ public:
 
 private:
     SDL_Renderer* renderer;
+    TextCache* textCache;
     TTF_Font* fontLarge;
     TTF_Font* fontMedium;
     TTF_Font* fontSmall;
@@ -9,9 +9,16 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <cstdint>
 #include <ctime>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include "json.hpp"
+#include "StringInterner.hpp"
 
 using json = nlohmann::json;
 
@@ -41,10 +48,12 @@ struct SaveData {
     // Units (alive and dead)
     std::vector<UnitSaveData> units;
     
-    // Event flags and variables
-    std::map<std::string, bool> event_flags;      // Triggered events, recruitments, etc.
-    std::map<std::string, int> variables;         // Numeric game variables
-    std::map<std::string, int> support_levels;    // Character pair support levels
+    // Event flags and variables, keyed on interned name handles
+    // (StringInterner). Serialization converts handles back to the
+    // original strings, so save files stay readable and stable.
+    std::unordered_map<uint32_t, bool> event_flags;   // Triggered events, recruitments, etc.
+    std::unordered_map<uint32_t, int> variables;      // Numeric game variables
+    std::unordered_map<uint32_t, int> support_levels; // Character pair support levels
     
     // Inventory and resources
     std::vector<ItemData> convoy;        // Storage inventory
@@ -53,7 +62,7 @@ struct SaveData {
     // Battle state (for suspend saves)
     bool is_mid_battle;
     std::string current_map;
-    std::vector<std::pair<std::string, std::pair<int, int>>> unit_positions; // unit_id -> (x, y)
+    std::vector<std::pair<uint32_t, std::pair<int, int>>> unit_positions; // interned unit_id -> (x, y)
     
     SaveData();
     json to_json() const;
@@ -64,10 +73,10 @@ struct SaveData {
  * Individual unit save data
  */
 struct UnitSaveData {
-    std::string character_id;            // 8-digit character ID linking to story character
-    std::string unit_name;
-    std::string class_name;
-    
+    uint32_t character_id = StringInterner::EMPTY; // Interned 8-digit character ID handle
+    std::string unit_name;                         // Display text, not an identifier
+    uint32_t class_name = StringInterner::EMPTY;   // Interned class name handle
+
     int level;
     int experience;
     
@@ -98,7 +107,7 @@ struct UnitSaveData {
  * Item/Weapon data in inventory
  */
 struct ItemData {
-    std::string item_id;                 // Weapon or item name
+    uint32_t item_id = StringInterner::EMPTY; // Interned weapon/item ID handle
     int uses_remaining;                  // Durability
     bool is_equipped;                    // For weapons
     
@@ -106,6 +115,18 @@ struct ItemData {
     void from_json(const json& j);
 };
 
+/**
+ * Slot metadata readable without deserializing a full save
+ */
+struct SaveHeaderInfo {
+    std::string slot_name;
+    time_t timestamp;
+    int current_chapter;
+    int turn_count;
+
+    SaveHeaderInfo() : timestamp(0), current_chapter(0), turn_count(0) {}
+};
+
 /**
  * Save file manager
  * Handles all save/load operations with format detection
@@ -123,7 +144,38 @@ public:
      * @return true if successful
      */
     bool save(const SaveData& data, int slot_number, bool use_json = false);
-    
+
+    /**
+     * Called on the game thread by update() when an async save finishes
+     */
+    using SaveCompleteCallback = std::function<void(int slot_number, bool success)>;
+
+    /**
+     * Save on a background worker thread. The SaveData is taken by value
+     * (move it in) so the game thread only pays for the snapshot;
+     * serialization, checksum, encryption and file I/O all happen on the
+     * worker. Files are written to a temp path and renamed on completion,
+     * so a crash mid-write never truncates an existing slot. Requests for
+     * the same slot queue in order; the last write wins.
+     * @param data Snapshot to write (moved from)
+     * @param slot_number Save slot (0-4 manual, -1 autosave, -2 suspend)
+     * @param callback Invoked from update() once the save completes
+     * @param use_json Force JSON format (for debug builds)
+     */
+    void save_async(SaveData data, int slot_number,
+                    SaveCompleteCallback callback = nullptr, bool use_json = false);
+
+    /**
+     * Deliver completion callbacks for finished async saves. Call once
+     * per frame from the game thread.
+     */
+    void update();
+
+    /**
+     * True while any async save is queued or being written
+     */
+    bool save_pending() const;
+
     /**
      * Load data from file
      * @param slot_number Save slot to load from
@@ -141,6 +193,14 @@ public:
      * Get save slot metadata without loading full data
      */
     bool get_slot_info(int slot_number, std::string& slot_name, time_t& timestamp);
+
+    /**
+     * Read only the slot header (name, timestamp, chapter, turn count).
+     * For version 2 binary saves this decrypts just the first block of the
+     * file instead of the whole save, so the slot screen can list large
+     * saves without deserializing units and convoy.
+     */
+    bool peek(int slot_number, SaveHeaderInfo& info);
     
     /**
      * Delete a save slot
@@ -182,7 +242,41 @@ public:
 private:
     std::string save_directory_;
     std::string project_subdirectory_;  // Optional project-specific subdirectory
-    static constexpr uint32_t SAVE_VERSION = 1;
+
+    // One queued async save
+    struct SaveRequest {
+        SaveData data;
+        int slot_number;
+        bool use_json;
+        SaveCompleteCallback callback;
+    };
+
+    // One finished async save, waiting for update() to run its callback
+    struct CompletedSave {
+        int slot_number;
+        bool success;
+        SaveCompleteCallback callback;
+    };
+
+    // Async save worker: started lazily on the first save_async so the
+    // manager stays thread-free for purely synchronous use (tools, bench)
+    std::thread save_worker_;
+    mutable std::mutex queue_mutex_;
+    std::condition_variable queue_condition_;
+    std::deque<SaveRequest> save_queue_;
+    bool worker_running_ = false;
+    int pending_saves_ = 0;  // Queued + in-flight, guarded by queue_mutex_
+
+    std::mutex done_mutex_;
+    std::vector<CompletedSave> completed_saves_;
+
+    void start_save_worker();
+    void save_worker_loop();
+    // Version 1 payloads were a JSON dump inside the binary wrapper;
+    // version 2 is the direct binary codec; version 3 compresses the
+    // codec output per chunk and adds CRC32 integrity (all still
+    // loadable: see load_binary)
+    static constexpr uint32_t SAVE_VERSION = 3;
     static constexpr uint32_t MAGIC_NUMBER = 0x4C485246; // "LHRF" (Lehran Fire)
     
     // Encryption key (in real implementation, this should be more secure)
@@ -197,6 +291,14 @@ private:
     // Binary format operations
     bool save_binary(const SaveData& data, const std::string& path);
     bool load_binary(const std::string& path, SaveData& data);
+
+    // Direct binary codec (version 2 payload)
+    void serialize_save_data(std::vector<uint8_t>& buffer, const SaveData& data);
+    void deserialize_save_data(const uint8_t* data, size_t& offset, SaveData& out);
+    void write_item(std::vector<uint8_t>& buffer, const ItemData& item);
+    ItemData read_item(const uint8_t* data, size_t& offset);
+    void write_unit(std::vector<uint8_t>& buffer, const UnitSaveData& unit);
+    UnitSaveData read_unit(const uint8_t* data, size_t& offset);
     
     // JSON format operations
     bool save_json(const SaveData& data, const std::string& path);
@@ -205,20 +307,31 @@ private:
     // Encryption/Decryption
     void encrypt_data(std::vector<uint8_t>& data);
     void decrypt_data(std::vector<uint8_t>& data);
-    
-    // Checksum calculation
-    uint32_t calculate_checksum(const std::vector<uint8_t>& data);
-    
+
+    // Integrity + encryption, fused so the buffer is traversed once per
+    // direction. CRC32 (slice-by-8) runs over the plaintext bytes.
+    uint32_t encrypt_and_crc(std::vector<uint8_t>& data);
+    uint32_t decrypt_and_crc(std::vector<uint8_t>& data, size_t crc_length);
+
+    // Chunked compression (version 3 payload). Each chunk is stored raw
+    // (high bit set on its stored size) when compression does not shrink it.
+    static constexpr size_t COMPRESS_CHUNK_SIZE = 64 * 1024;
+    static constexpr uint32_t CHUNK_STORED_FLAG = 0x80000000u;
+    static size_t compress_chunk(const uint8_t* src, size_t src_len, std::vector<uint8_t>& out);
+    static bool decompress_chunk(const uint8_t* src, size_t src_len, uint8_t* dst, size_t dst_len);
+
     // Binary serialization helpers
     void write_uint32(std::vector<uint8_t>& buffer, uint32_t value);
     void write_int32(std::vector<uint8_t>& buffer, int32_t value);
     void write_string(std::vector<uint8_t>& buffer, const std::string& str);
     void write_bool(std::vector<uint8_t>& buffer, bool value);
-    
+    void write_uint64(std::vector<uint8_t>& buffer, uint64_t value);
+
     uint32_t read_uint32(const uint8_t* data, size_t& offset);
     int32_t read_int32(const uint8_t* data, size_t& offset);
     std::string read_string(const uint8_t* data, size_t& offset);
     bool read_bool(const uint8_t* data, size_t& offset);
+    uint64_t read_uint64(const uint8_t* data, size_t& offset);
     
     // Utility
     void ensure_save_directory();
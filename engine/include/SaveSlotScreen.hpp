@@ -3,6 +3,7 @@
 #include <SDL.h>
 #include <SDL_ttf.h>
 #include "SaveManager.hpp"
+#include "TextCache.hpp"
 #include <string>
 #include <vector>
 
@@ -30,7 +31,8 @@ private:
     TTF_Font* fontMedium;
     TTF_Font* fontSmall;
     Lehran::SaveManager* saveManager;
-    
+    Lehran::TextCache* textCache;
+
     Mode currentMode;
     int selectedSlot;
     std::vector<SlotInfo> slots;
@@ -48,8 +50,9 @@ private:
     std::string FormatPlaytime(int seconds);
     
 public:
-    SaveSlotScreen(SDL_Renderer* renderer, TTF_Font* fontLarge, TTF_Font* fontMedium, 
-                   TTF_Font* fontSmall, Lehran::SaveManager* saveManager);
+    SaveSlotScreen(SDL_Renderer* renderer, TTF_Font* fontLarge, TTF_Font* fontMedium,
+                   TTF_Font* fontSmall, Lehran::SaveManager* saveManager,
+                   Lehran::TextCache* textCache);
     
     void SetMode(Mode mode);
     void HandleInput(SDL_Keycode key);
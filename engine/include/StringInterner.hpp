@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Lehran {
+
+/**
+ * Global string-interning table. Identifier strings (unit ids, item ids,
+ * event flag names, support pair keys) are folded to 32-bit handles at
+ * data-load time; hot structures store and compare the handles, and the
+ * original strings only reappear at the data-file boundary (JSON fields,
+ * save files, log messages).
+ *
+ * Handle 0 is always the empty string, so zero-initialized handles are
+ * valid and Lookup never fails: unknown handles resolve to "".
+ *
+ * The table is append-only and guarded by a mutex, so any thread may
+ * intern or look up (the save worker serializes handles back to strings
+ * while the game thread keeps loading data). Entries live in a deque,
+ * which never moves elements on append, so the references Lookup hands
+ * out stay valid for the life of the program.
+ */
+class StringInterner {
+public:
+    static const uint32_t EMPTY = 0;
+
+    // Return the handle for a string, adding it to the table on first use
+    static uint32_t Intern(const std::string& value);
+
+    // Return the string for a handle ("" for unknown handles)
+    static const std::string& Lookup(uint32_t handle);
+
+    // Number of interned strings (including the empty string)
+    static size_t Count();
+
+private:
+    static std::deque<std::string> strings;
+    static std::unordered_map<std::string, uint32_t> handles;
+    static std::mutex mutex;
+};
+
+} // namespace Lehran
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace Lehran {
+
+// Shared LRU cache of rasterized text textures. Every system that draws UI
+// text (RenderManager, MapManager, DialogueSystem, SaveSlotScreen) renders
+// through this so steady-state frames reuse the same texture instead of
+// paying TTF_RenderText_Blended plus a GPU upload per string per frame.
+// Entries are keyed by (string, font, r, g, b); alpha is applied as a
+// per-draw texture modulation so fading text doesn't create one entry per
+// alpha step.
+class TextCache {
+private:
+    struct TextKey {
+        std::string text;
+        TTF_Font* font;
+        Uint8 r, g, b;
+
+        bool operator==(const TextKey& other) const {
+            return font == other.font && r == other.r && g == other.g &&
+                   b == other.b && text == other.text;
+        }
+    };
+
+    struct TextKeyHash {
+        size_t operator()(const TextKey& key) const {
+            size_t hash = std::hash<std::string>()(key.text);
+            hash ^= std::hash<void*>()(key.font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= (size_t)(key.r | (key.g << 8) | (key.b << 16)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
+    struct Entry {
+        TextKey key;
+        SDL_Texture* texture;
+        int width;
+        int height;
+    };
+
+    SDL_Renderer* renderer;
+    size_t maxEntries;
+    std::list<Entry> lruList;  // Front = most recently used
+    std::unordered_map<TextKey, std::list<Entry>::iterator, TextKeyHash> lookup;
+
+public:
+    TextCache(SDL_Renderer* renderer, size_t maxEntries = 256);
+    ~TextCache();
+
+    // Get the cached texture for a string, rasterizing it on first use.
+    // Returns the texture and its pixel size; the cache owns the texture,
+    // so callers must not destroy it. The color's alpha component is
+    // applied via SDL_SetTextureAlphaMod before returning.
+    SDL_Texture* GetTexture(const std::string& text, TTF_Font* font, SDL_Color color,
+                            int& width, int& height);
+
+    // Drop every cached texture (call when fonts are reloaded)
+    void Clear();
+};
+
+} // namespace Lehran
@@ -2,32 +2,125 @@
 
 #include <SDL.h>
 #include <SDL_image.h>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <memory>
 
 class TextureManager {
+public:
+    // Handle into a shared atlas page: the page texture plus the source
+    // rect of one packed image. Oversized images fall back to a standalone
+    // texture with a src rect covering the whole surface.
+    struct AtlasRegion {
+        SDL_Texture* texture;
+        SDL_Rect src;
+
+        AtlasRegion() : texture(nullptr), src{0, 0, 0, 0} {}
+        bool IsValid() const { return texture != nullptr; }
+    };
+
 private:
+    // Atlas pages are packed on the CPU surface with a simple shelf packer
+    // and uploaded to a fixed STATIC texture, so handles stay valid as more
+    // images are packed after the first upload.
+    struct AtlasPage {
+        SDL_Surface* surface;
+        SDL_Texture* texture;
+        bool dirty;
+        int shelfX;
+        int shelfY;
+        int shelfHeight;
+    };
+
+    static const int ATLAS_PAGE_SIZE = 1024;
+    static const int ATLAS_MAX_IMAGE = 256;  // Larger images stay standalone
+    static const int ATLAS_PADDING = 1;      // Gutter against bleed when scaled
+
+    // Standalone cached texture plus the bookkeeping the memory budget
+    // needs: size for accounting, a ref count to pin entries that raw
+    // pointers (e.g. atlas fallback regions) still reference, and a
+    // monotonic use stamp for LRU ordering.
+    struct CacheEntry {
+        SDL_Texture* texture;
+        size_t bytes;      // width * height * 4
+        int refCount;      // Never evicted while > 0
+        uint64_t lastUse;
+    };
+
     SDL_Renderer* renderer;
-    std::unordered_map<std::string, SDL_Texture*> textureCache;
-    
+    std::unordered_map<std::string, CacheEntry> textureCache;
+    std::vector<AtlasPage> atlasPages;
+    std::unordered_map<std::string, AtlasRegion> atlasRegions;
+
+    // Surfaces delivered by the background streamer, waiting to be turned
+    // into textures or packed into atlas pages (main thread only)
+    std::unordered_map<std::string, SDL_Surface*> streamedSurfaces;
+
+    // Memory budget: total bytes of cache entries + atlas pages. When an
+    // insert pushes the total over budget, unreferenced standalone
+    // textures are evicted least-recently-used first. Pages never move.
+    size_t memoryBudget;  // Bytes, 0 = unlimited
+    size_t totalBytes;
+    uint64_t useCounter;
+
+    bool PackIntoPage(AtlasPage& page, SDL_Surface* surface, SDL_Rect& outSrc);
+    AtlasPage* CreateAtlasPage();
+    SDL_Surface* TakeStreamedSurface(const std::string& filePath);
+    void InsertCacheEntry(const std::string& filePath, SDL_Texture* texture, int width, int height);
+    void EnforceBudget();
+
 public:
     explicit TextureManager(SDL_Renderer* renderer);
     ~TextureManager();
-    
+
     // Load a texture from file (caches it for future use)
     SDL_Texture* LoadTexture(const std::string& filePath);
-    
+
+    // Load a small image into a shared atlas page (caches the handle).
+    // Images larger than ATLAS_MAX_IMAGE get their own texture so one huge
+    // background can't flush tiles off a page.
+    AtlasRegion LoadIntoAtlas(const std::string& filePath);
+
     // Render a texture at position with optional scaling
     void RenderTexture(SDL_Texture* texture, int x, int y, int width = -1, int height = -1);
     void RenderTexture(const std::string& filePath, int x, int y, int width = -1, int height = -1);
-    
+
+    // Render a packed atlas region; consecutive calls against the same page
+    // batch into one texture bind inside the SDL renderer
+    void RenderAtlasRegion(const AtlasRegion& region, int x, int y, int width = -1, int height = -1);
+
+    // Upload any atlas pages modified since the last upload. Called
+    // automatically by RenderAtlasRegion; call directly before rendering
+    // atlas regions through raw SDL_RenderCopy (e.g. into a render target).
+    void FlushAtlasPages();
+
+    // Accept a surface the AssetStreamer loaded off-thread; LoadTexture and
+    // LoadIntoAtlas consume these instead of hitting the disk again
+    void StoreStreamedSurface(const std::string& filePath, SDL_Surface* surface);
+
+    // Upload up to maxUploads streamed surfaces to the GPU. Only surfaces
+    // too large for the atlas are uploaded eagerly; atlas-sized ones wait
+    // for their LoadIntoAtlas/LoadTexture call. Returns uploads performed.
+    int UploadStreamedSurfaces(int maxUploads);
+
+    // Set the texture memory budget in bytes (0 = unlimited) and evict
+    // down to it immediately
+    void SetMemoryBudget(size_t bytes);
+    size_t GetCacheBytes() const { return totalBytes; }
+
+    // Pin/unpin a cached texture while a raw SDL_Texture* to it is held
+    // outside the per-frame Load/Render path
+    void AddTextureRef(const std::string& filePath);
+    void ReleaseTextureRef(const std::string& filePath);
+
     // Clear a specific texture from cache
     void UnloadTexture(const std::string& filePath);
-    
+
     // Clear all textures from cache
     void ClearCache();
-    
+
     // Get texture dimensions
     bool GetTextureDimensions(SDL_Texture* texture, int& width, int& height);
 };
@@ -13,14 +13,19 @@
 #include "json.hpp"
 #include "SaveManager.hpp"
 #include "TextureManager.hpp"
+#include "TextCache.hpp"
+#include "AssetStreamer.hpp"
+#include "AudioManager.hpp"
 #include "SaveSlotScreen.hpp"
 #include "SceneManager.hpp"
 #include "DialogueSystem.hpp"
 #include "ConfigManager.hpp"
 #include "RenderManager.hpp"
 #include "GameStateManager.hpp"
+#include "GameFlowGraph.hpp"
 #include "InputHandler.hpp"
 #include "MapManager.hpp"
+#include "Profiler.hpp"
 
 using json = nlohmann::json;
 
@@ -35,11 +40,10 @@ private:
     TTF_Font* fontLarge;
     TTF_Font* fontMedium;
     TTF_Font* fontSmall;
-    Mix_Music* bgm;
-    std::string currentMusicPath;  // Track currently playing music
     json gameData;
     json audioAssignments;
     json gameFlow;
+    Lehran::GameFlowGraph gameFlowGraph;
     std::string gameName;
     bool audioInitialized;
     
@@ -50,19 +54,24 @@ private:
     Lehran::InputHandler* inputHandler;
     Lehran::SaveManager* saveManager;
     TextureManager* textureManager;
+    AssetStreamer* assetStreamer;
+    AudioManager* audioManager;
+    Lehran::TextCache* textCache;
     SaveSlotScreen* saveSlotScreen;
     SceneManager* sceneManager;
     DialogueSystem* dialogueSystem;
     Lehran::MapManager* mapManager;
-    
+    Lehran::Profiler* profiler;
+
 public:
     LehranEngine() : window(nullptr), renderer(nullptr), 
                      fontLarge(nullptr), fontMedium(nullptr), fontSmall(nullptr),
-                     bgm(nullptr), currentMusicPath(""), audioInitialized(false),
+                     audioInitialized(false),
                      configManager(nullptr), renderManager(nullptr), stateManager(nullptr),
                      inputHandler(nullptr), saveManager(nullptr), textureManager(nullptr),
+                     assetStreamer(nullptr), audioManager(nullptr), textCache(nullptr),
                      saveSlotScreen(nullptr), sceneManager(nullptr),
-                     dialogueSystem(nullptr), mapManager(nullptr) {}
+                     dialogueSystem(nullptr), mapManager(nullptr), profiler(nullptr) {}
     
     bool Initialize() {
         // Create modular systems first
@@ -72,7 +81,9 @@ public:
         
         // Load engine settings
         configManager->LoadEngineSettings();
-        
+        inputHandler->SetCursorRepeat(configManager->GetCursorInitialDelayTicks(),
+                                      configManager->GetCursorRepeatTicks());
+
         // Initialize SDL
         if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0) {
             std::cerr << "SDL initialization failed: " << SDL_GetError() << std::endl;
@@ -143,7 +154,8 @@ public:
         }
         
         // Create renderer
-        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+        // Target-texture support is needed for the baked map layer cache
+        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_TARGETTEXTURE);
         if (!renderer) {
             std::cerr << "Renderer creation failed: " << SDL_GetError() << std::endl;
             return false;
@@ -171,22 +183,42 @@ public:
             }
         }
         
-        // Initialize render manager
-        renderManager = new Lehran::RenderManager(renderer, fontLarge, fontMedium, fontSmall);
-        
+        // Initialize render manager (text goes through the shared cache)
+        textCache = new Lehran::TextCache(renderer);
+        renderManager = new Lehran::RenderManager(renderer, textCache, fontLarge, fontMedium, fontSmall);
+
         // Initialize game systems
         saveManager = new Lehran::SaveManager();
         textureManager = new TextureManager(renderer);
-        
+        textureManager->SetMemoryBudget((size_t)configManager->GetTextureBudgetMB() * 1024 * 1024);
+        assetStreamer = new AssetStreamer(textureManager);
+
         // Load game data
         LoadGameData();
-        
+
+        // Compile the game flow into a node graph up front: every
+        // reachable scene file is parsed and every referenced asset is
+        // probed once here, so transitions later are just index hops
+        if (!gameFlowGraph.Compile(gameFlow)) {
+            std::cerr << "ERROR: Game flow compilation failed - scene playback will not work" << std::endl;
+        }
+        stateManager->SetGameFlow(&gameFlowGraph);
+
+        // Audio: pre-decode the SFX pool now so gameplay never loads
+        // sounds mid-frame; music requests stream in on a worker thread
+        audioManager = new AudioManager(audioInitialized);
+        audioManager->PreloadSFX(audioAssignments);
+
+        // Start streaming the test map's assets while the title screen is up
+        assetStreamer->QueueMapPreload("maps/Battle/test_map.json");
+
         // Initialize remaining systems
-        saveSlotScreen = new SaveSlotScreen(renderer, fontLarge, fontMedium, fontSmall, saveManager);
+        saveSlotScreen = new SaveSlotScreen(renderer, fontLarge, fontMedium, fontSmall, saveManager, textCache);
         sceneManager = new SceneManager(renderer, textureManager);
-        dialogueSystem = new DialogueSystem(renderer, fontMedium, fontSmall, textureManager);
-        mapManager = new Lehran::MapManager(renderer, textureManager, configManager, fontMedium);
-        
+        dialogueSystem = new DialogueSystem(renderer, fontMedium, fontSmall, textureManager, textCache);
+        mapManager = new Lehran::MapManager(renderer, textureManager, configManager, fontMedium, textCache, audioManager);
+        profiler = new Lehran::Profiler();
+
         // Setup input handler callbacks
         SetupInputCallbacks();
         
@@ -248,7 +280,7 @@ public:
             } else if (action <= -100) {
                 // Game start signal
                 int slotNumber = -(action + 1000);
-                stateManager->StartGameFromSlot(slotNumber, saveManager, gameFlow);
+                stateManager->StartGameFromSlot(slotNumber, saveManager);
                 if (!stateManager->GetCurrentSceneId().empty()) {
                     stateManager->LoadScene(stateManager->GetCurrentSceneId(), sceneManager, dialogueSystem);
                 }
@@ -390,6 +422,22 @@ public:
         inputHandler->SetMapToggleUnitInfoCallback([this]() {
             mapManager->ToggleUnitInfo();
         });
+
+        inputHandler->SetMapToggleDangerZoneCallback([this]() {
+            mapManager->ToggleDangerZone();
+        });
+
+        // Autosave every turn: snapshot on the game thread, write on the
+        // save worker so the frame never waits on serialization or I/O
+        mapManager->SetTurnEndCallback([this]() {
+            Lehran::SaveData data;
+            mapManager->CaptureSaveData(data);
+            saveManager->save_async(std::move(data), -1, [](int, bool success) {
+                if (!success) {
+                    std::cerr << "WARNING: Autosave failed" << std::endl;
+                }
+            });
+        });
     }
     
     void SetupStateCallbacks() {
@@ -420,36 +468,14 @@ public:
         
         if (!shouldPlayMusic) {
             std::cout << "Title music set to (None) - running without music" << std::endl;
-            currentMusicPath = "";
+            audioManager->StopMusic();
             return;
         }
-        
-        // Check if this music is already playing
-        if (currentMusicPath == musicPath && Mix_PlayingMusic()) {
-            std::cout << "Title music already playing, not restarting" << std::endl;
-            return;
-        }
-        
-        if (bgm) {
-            Mix_FreeMusic(bgm);
-            bgm = nullptr;
-        }
-        
-        bgm = Mix_LoadMUS(musicPath.c_str());
-        
-        if (!bgm) {
-            std::cerr << "Failed to load music: " << Mix_GetError() << std::endl;
-            currentMusicPath = "";
-        } else {
-            std::cout << "Title music loaded successfully from: " << musicPath << std::endl;
-            if (Mix_PlayMusic(bgm, -1) == -1) {
-                std::cerr << "Failed to play music: " << Mix_GetError() << std::endl;
-                currentMusicPath = "";
-            } else {
-                configManager->ApplyAudioVolumes(audioInitialized);
-                currentMusicPath = musicPath;
-            }
-        }
+
+        // AudioManager loads on its worker thread and crossfades in;
+        // re-requesting the playing track is a no-op
+        audioManager->PlayMusic(musicPath);
+        configManager->ApplyAudioVolumes(audioInitialized);
     }
     
     void LoadGameData() {
@@ -523,22 +549,10 @@ public:
             // Map Test
             mapManager->LoadMap("maps/Battle/test_map.json");
             
-            // Load map music if specified
+            // Load map music if specified (streams in off the main thread)
             std::string mapMusic = mapManager->GetMapMusic();
             if (!mapMusic.empty()) {
-                if (bgm) {
-                    Mix_FreeMusic(bgm);
-                    bgm = nullptr;
-                }
-                bgm = Mix_LoadMUS(mapMusic.c_str());
-                if (bgm) {
-                    Mix_PlayMusic(bgm, -1);
-                    currentMusicPath = mapMusic;
-                    std::cout << "Playing map music: " << mapMusic << std::endl;
-                } else {
-                    std::cerr << "Failed to load map music: " << mapMusic << std::endl;
-                    currentMusicPath = "";
-                }
+                audioManager->PlayMusic(mapMusic);
             }
             
             stateManager->SetCurrentState(Lehran::GameState::STATE_MAP);
@@ -610,28 +624,9 @@ public:
     
     void LoadSceneMusic(const std::string& musicFile) {
         if (!audioInitialized) return;
-        
-        if (bgm) {
-            Mix_FreeMusic(bgm);
-            bgm = nullptr;
-        }
-        
-        std::string musicPath = "assets/" + musicFile;
-        bgm = Mix_LoadMUS(musicPath.c_str());
-        
-        if (!bgm) {
-            std::cerr << "Failed to load scene music: " << Mix_GetError() << std::endl;
-            currentMusicPath = "";
-        } else {
-            std::cout << "Scene music loaded: " << musicPath << std::endl;
-            if (Mix_PlayMusic(bgm, -1) == -1) {
-                std::cerr << "Failed to play scene music: " << Mix_GetError() << std::endl;
-                currentMusicPath = "";
-            } else {
-                configManager->ApplyAudioVolumes(audioInitialized);
-                currentMusicPath = musicPath;
-            }
-        }
+
+        audioManager->PlayMusic("assets/" + musicFile);
+        configManager->ApplyAudioVolumes(audioInitialized);
     }
     
     void CycleWindowMode() {
@@ -641,30 +636,98 @@ public:
     void Run() {
         bool running = true;
         SDL_Event event;
-        Uint32 lastTime = SDL_GetTicks();
-        
+
+        // Fixed-timestep simulation: Update() always runs at SIMULATION_HZ
+        // regardless of render rate, with an accumulator carrying the
+        // remainder between frames. Stalls are clamped so a long hitch
+        // (window drag, debugger break) doesn't trigger a catch-up spiral.
+        const double FIXED_STEP = 1.0 / 60.0;
+        const double MAX_FRAME_DELTA = 0.25;
+
+        const double perfFreq = (double)SDL_GetPerformanceFrequency();
+        Uint64 lastCounter = SDL_GetPerformanceCounter();
+        double accumulator = 0.0;
+
         while (running && stateManager->GetCurrentState() != Lehran::GameState::STATE_QUIT) {
-            Uint32 currentTime = SDL_GetTicks();
-            float deltaTime = (currentTime - lastTime) / 1000.0f;
-            lastTime = currentTime;
-            
+            Uint64 frameBegin = SDL_GetPerformanceCounter();
+            double frameDelta = (double)(frameBegin - lastCounter) / perfFreq;
+            lastCounter = frameBegin;
+            if (frameDelta > MAX_FRAME_DELTA) {
+                frameDelta = MAX_FRAME_DELTA;
+            }
+            accumulator += frameDelta;
+
+            profiler->BeginFrame();
+
             // Handle events
-            while (SDL_PollEvent(&event)) {
-                if (event.type == SDL_QUIT) {
-                    running = false;
-                } else if (event.type == SDL_KEYDOWN) {
-                    inputHandler->HandleKeyDown(event.key.keysym.sym, stateManager->GetCurrentState());
-                } else if (event.type == SDL_MOUSEWHEEL) {
-                    inputHandler->HandleMouseWheel(event.wheel.y, stateManager->GetCurrentState());
+            {
+                Lehran::Profiler::Zone zone(profiler, "Events");
+                while (SDL_PollEvent(&event)) {
+                    if (event.type == SDL_QUIT) {
+                        running = false;
+                    } else if (event.type == SDL_KEYDOWN) {
+                        // Profiler hotkeys: F3 toggles the HUD, F4 toggles CSV capture
+                        if (event.key.keysym.sym == SDLK_F3) {
+                            profiler->ToggleHUD();
+                        } else if (event.key.keysym.sym == SDLK_F4) {
+                            profiler->ToggleCapture();
+                        } else {
+                            inputHandler->HandleKeyDown(event.key.keysym.sym, stateManager->GetCurrentState());
+                        }
+                    } else if (event.type == SDL_MOUSEWHEEL) {
+                        inputHandler->HandleMouseWheel(event.wheel.y, stateManager->GetCurrentState());
+                    }
+                }
+            }
+
+            {
+                Lehran::Profiler::Zone zone(profiler, "Update");
+                while (accumulator >= FIXED_STEP) {
+                    Update((float)FIXED_STEP);
+                    accumulator -= FIXED_STEP;
+                }
+            }
+
+            // Pull finished background loads in under a per-frame budget
+            {
+                Lehran::Profiler::Zone zone(profiler, "Streaming");
+                assetStreamer->Update();
+                audioManager->Update();
+                saveManager->update();
+            }
+
+            {
+                Lehran::Profiler::Zone zone(profiler, "Render");
+                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+                SDL_RenderClear(renderer);
+                Render();
+                profiler->RenderHUD(renderManager, renderer, fontSmall);
+            }
+
+            {
+                Lehran::Profiler::Zone zone(profiler, "Present");
+                SDL_RenderPresent(renderer);
+            }
+
+            profiler->EndFrame();
+
+            // Frame limiter: coarse sleep leaves ~1ms which is spun off
+            // against the performance counter for precise pacing. With
+            // vsync off this keeps the loop from burning a full core.
+            int fpsCap = configManager->GetFPSCap();
+            if (fpsCap > 0) {
+                const double targetSeconds = 1.0 / (double)fpsCap;
+                for (;;) {
+                    double elapsed = (double)(SDL_GetPerformanceCounter() - frameBegin) / perfFreq;
+                    double remaining = targetSeconds - elapsed;
+                    if (remaining <= 0.0) {
+                        break;
+                    }
+                    if (remaining > 0.002) {
+                        SDL_Delay((Uint32)((remaining - 0.001) * 1000.0));
+                    }
                 }
             }
-            
-            Update(deltaTime);
-            
-            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-            SDL_RenderClear(renderer);
-            Render();
-            SDL_RenderPresent(renderer);
         }
     }
     
@@ -718,7 +781,10 @@ public:
     
     void Update(float deltaTime) {
         Lehran::GameState currentState = stateManager->GetCurrentState();
-        
+
+        // Held-key movement is sampled per tick, not per key-repeat event
+        inputHandler->PollHeldKeys(currentState);
+
         if (currentState == Lehran::GameState::STATE_SPLASH) {
             stateManager->UpdateSplashTimer(deltaTime);
             if (stateManager->ShouldTransitionFromSplash()) {
@@ -734,6 +800,8 @@ public:
             }
         } else if (currentState == Lehran::GameState::STATE_DIALOGUE) {
             dialogueSystem->Update(deltaTime);
+        } else if (currentState == Lehran::GameState::STATE_MAP) {
+            mapManager->Update(deltaTime);
         }
     }
     
@@ -774,10 +842,14 @@ public:
     }
     
     void Cleanup() {
+        delete profiler;
         delete mapManager;
         delete dialogueSystem;
         delete sceneManager;
         delete saveSlotScreen;
+        delete textCache;
+        delete assetStreamer;
+        delete audioManager;
         delete textureManager;
         delete saveManager;
         delete inputHandler;
@@ -785,10 +857,6 @@ public:
         delete renderManager;
         delete configManager;
         
-        if (bgm) {
-            Mix_FreeMusic(bgm);
-            bgm = nullptr;
-        }
         if (audioInitialized) {
             Mix_CloseAudio();
         }
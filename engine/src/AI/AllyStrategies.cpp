@@ -0,0 +1,22 @@
+#include "AllyStrategies.hpp"
+
+namespace Lehran {
+
+std::vector<EnemyAction> AllyStrategies::DecidePhase(const EnemyPhaseView& view,
+                                                     const std::vector<MapUnitHot>& unitsHot,
+                                                     const std::vector<CombatantStats>& stats,
+                                                     const std::vector<int>& attackRangeByUnit) {
+    // The enemy engine is side-symmetric: it moves every unit with
+    // isPlayer == false against every unit with isPlayer == true. Flip
+    // the flag on a copy of the hot array and it decides the player
+    // phase instead - one scoring function to tune, identical behavior
+    // on both sides, and the parallel worker pool comes for free.
+    std::vector<MapUnitHot> flipped = unitsHot;
+    for (MapUnitHot& unit : flipped) {
+        unit.isPlayer = !unit.isPlayer;
+    }
+
+    return EnemyStrategies::DecidePhase(view, flipped, stats, attackRangeByUnit);
+}
+
+} // namespace Lehran
@@ -0,0 +1,148 @@
+#include "AutoBattleStrategies.hpp"
+#include "DamageCalculation.hpp"
+#include <cstdlib>
+
+namespace Lehran {
+
+namespace {
+    // xorshift32: tiny, deterministic, and independent of rand() state
+    // elsewhere in the engine, so simulation replays never drift.
+    uint32_t NextRandom(uint32_t& state) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    int Roll100(uint32_t& state) {
+        return (int)(NextRandom(state) % 100);
+    }
+}
+
+int AutoBattleStrategies::ResolveCombat(int attackerIndex, int defenderIndex,
+                                        std::vector<MapUnitHot>& units,
+                                        const std::vector<CombatantStats>& stats,
+                                        const std::vector<int>& attackRangeByUnit,
+                                        uint32_t& rngState) {
+    int playerHpLost = 0;
+
+    // One strike sequence: roll each forecast hit, crits triple damage
+    auto strike = [&](int from, int to) {
+        CombatForecast forecast = DamageCalculation::Forecast(stats[from], stats[to]);
+        for (int hit = 0; hit < forecast.hits && units[to].hp > 0; hit++) {
+            if (Roll100(rngState) >= forecast.hitChance) continue;
+            int damage = forecast.damage;
+            if (Roll100(rngState) < forecast.critChance) damage *= 3;
+            if (damage > units[to].hp) damage = units[to].hp;
+            units[to].hp -= damage;
+            if (units[to].isPlayer) playerHpLost += damage;
+        }
+    };
+
+    strike(attackerIndex, defenderIndex);
+
+    // Counterattack if the defender survived and the attacker sits
+    // inside the defender's weapon range
+    if (units[defenderIndex].hp > 0) {
+        int distance = std::abs(units[attackerIndex].x - units[defenderIndex].x)
+                     + std::abs(units[attackerIndex].y - units[defenderIndex].y);
+        int counterRange = (defenderIndex < (int)attackRangeByUnit.size())
+                               ? attackRangeByUnit[defenderIndex] : 1;
+        if (distance <= counterRange) {
+            strike(defenderIndex, attackerIndex);
+        }
+    }
+
+    return playerHpLost;
+}
+
+int AutoBattleStrategies::RunPhase(bool playerPhase,
+                                   EnemyPhaseView& view,
+                                   std::vector<MapUnitHot>& units,
+                                   const std::vector<CombatantStats>& stats,
+                                   const std::vector<int>& attackRangeByUnit,
+                                   uint32_t& rngState) {
+    std::vector<EnemyAction> actions =
+        playerPhase ? AllyStrategies::DecidePhase(view, units, stats, attackRangeByUnit)
+                    : EnemyStrategies::DecidePhase(view, units, stats, attackRangeByUnit);
+
+    int playerHpLost = 0;
+
+    // Apply in unit-index order. Decisions were made against the phase
+    // snapshot, the same staleness live enemy phases have, but moves and
+    // deaths update the view between actions so no two units stack.
+    for (const EnemyAction& action : actions) {
+        MapUnitHot& unit = units[action.unitIndex];
+        if (unit.hp <= 0) continue;  // Killed by a counter earlier this phase
+
+        int destIndex = action.moveY * view.width + action.moveX;
+        int occupant = view.occupancy[destIndex];
+        if (occupant >= 0 && occupant != action.unitIndex) continue;  // Tile taken, forfeit
+
+        view.occupancy[unit.y * view.width + unit.x] = -1;
+        unit.x = action.moveX;
+        unit.y = action.moveY;
+        view.occupancy[destIndex] = action.unitIndex;
+
+        if (action.targetIndex >= 0 && units[action.targetIndex].hp > 0) {
+            playerHpLost += ResolveCombat(action.unitIndex, action.targetIndex,
+                                          units, stats, attackRangeByUnit, rngState);
+
+            // Clear the fallen from the occupancy grid
+            for (int index : {action.unitIndex, action.targetIndex}) {
+                if (units[index].hp <= 0) {
+                    view.occupancy[units[index].y * view.width + units[index].x] = -1;
+                }
+            }
+        }
+    }
+
+    return playerHpLost;
+}
+
+AutoBattleResult AutoBattleStrategies::Simulate(const EnemyPhaseView& view,
+                                                const std::vector<MapUnitHot>& unitsHot,
+                                                const std::vector<CombatantStats>& stats,
+                                                const std::vector<int>& attackRangeByUnit,
+                                                int maxTurns,
+                                                uint32_t seed) {
+    AutoBattleResult result;
+
+    // Simulation state is all local copies; the caller's snapshot is
+    // reusable across runs (vary the seed for Monte Carlo batches)
+    EnemyPhaseView simView = view;
+    std::vector<MapUnitHot> units = unitsHot;
+    uint32_t rngState = (seed != 0) ? seed : 1;  // xorshift must not start at 0
+
+    auto countLiving = [&](bool player) {
+        int living = 0;
+        for (const MapUnitHot& unit : units) {
+            if (unit.isPlayer == player && unit.hp > 0) living++;
+        }
+        return living;
+    };
+
+    for (int turn = 1; turn <= maxTurns; turn++) {
+        result.turns = turn;
+
+        result.playerHpLost += RunPhase(true, simView, units, stats,
+                                        attackRangeByUnit, rngState);
+        if (countLiving(false) == 0) {
+            result.outcome = AutoBattleResult::PLAYER_WIN;
+            break;
+        }
+
+        result.playerHpLost += RunPhase(false, simView, units, stats,
+                                        attackRangeByUnit, rngState);
+        if (countLiving(true) == 0) {
+            result.outcome = AutoBattleResult::ENEMY_WIN;
+            break;
+        }
+    }
+
+    result.playerSurvivors = countLiving(true);
+    result.enemySurvivors = countLiving(false);
+    return result;
+}
+
+} // namespace Lehran
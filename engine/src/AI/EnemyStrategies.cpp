@@ -0,0 +1,189 @@
+#include "EnemyStrategies.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <future>
+#include <queue>
+#include <thread>
+
+namespace Lehran {
+
+EnemyAction EnemyStrategies::DecideUnit(int unitIndex, const EnemyPhaseView& view,
+                                        const std::vector<MapUnitHot>& unitsHot,
+                                        const std::vector<CombatantStats>& stats,
+                                        int attackRange) {
+    const MapUnitHot& unit = unitsHot[unitIndex];
+
+    EnemyAction action;
+    action.unitIndex = unitIndex;
+    action.moveX = unit.x;
+    action.moveY = unit.y;
+
+    if (view.width <= 0 || view.height <= 0) {
+        return action;
+    }
+
+    // Dijkstra flood fill over terrain costs, same expansion rules as
+    // CalculateMovementRange: units on the other team block, teammates
+    // can be passed through but not stopped on.
+    std::vector<int> cost(view.width * view.height, -1);
+    std::priority_queue<std::pair<int, int>,
+                        std::vector<std::pair<int, int>>,
+                        std::greater<std::pair<int, int>>> frontier;
+
+    int startIndex = unit.y * view.width + unit.x;
+    cost[startIndex] = 0;
+    frontier.push({0, startIndex});
+
+    const int dx[] = {1, -1, 0, 0};
+    const int dy[] = {0, 0, 1, -1};
+
+    while (!frontier.empty()) {
+        auto [tileCost, index] = frontier.top();
+        frontier.pop();
+        if (tileCost > cost[index]) continue;
+
+        int x = index % view.width;
+        int y = index / view.width;
+
+        for (int dir = 0; dir < 4; dir++) {
+            int nx = x + dx[dir];
+            int ny = y + dy[dir];
+            if (nx < 0 || ny < 0 || nx >= view.width || ny >= view.height) continue;
+
+            int neighborIndex = ny * view.width + nx;
+            int entryCost = view.tileCost[neighborIndex];
+            if (entryCost <= 0) continue;
+
+            int occupant = view.occupancy[neighborIndex];
+            if (occupant >= 0 && occupant != unitIndex &&
+                unitsHot[occupant].isPlayer != unit.isPlayer) continue;
+
+            int newCost = tileCost + entryCost;
+            if (newCost > unit.mov) continue;
+            if (cost[neighborIndex] < 0 || newCost < cost[neighborIndex]) {
+                cost[neighborIndex] = newCost;
+                frontier.push({newCost, neighborIndex});
+            }
+        }
+    }
+
+    // Forecasts are tile-independent, so batch this unit against every
+    // living player once up front; the tile scan then only reads them.
+    std::vector<int> targets;
+    std::vector<CombatantStats> attackerStats;
+    std::vector<CombatantStats> defenderStats;
+    for (int target = 0; target < (int)unitsHot.size(); target++) {
+        if (unitsHot[target].isPlayer && unitsHot[target].hp > 0) {
+            targets.push_back(target);
+            attackerStats.push_back(stats[unitIndex]);
+            defenderStats.push_back(stats[target]);
+        }
+    }
+    std::vector<CombatForecast> forecasts(targets.size());
+    DamageCalculation::ForecastBatch(attackerStats.data(), defenderStats.data(),
+                                     forecasts.data(), forecasts.size());
+
+    // Candidate scan: every reachable, stoppable tile x every living
+    // player inside weapon range of it. Strict > comparisons with
+    // index-ordered iteration keep the choice deterministic.
+    int bestScore = -1;
+    int fallbackDistance = INT32_MAX;
+
+    for (int index = 0; index < (int)cost.size(); index++) {
+        if (cost[index] < 0) continue;
+
+        int occupant = view.occupancy[index];
+        if (occupant >= 0 && occupant != unitIndex) continue;  // Can't stop on anyone
+
+        int tileX = index % view.width;
+        int tileY = index / view.width;
+
+        for (size_t t = 0; t < targets.size(); t++) {
+            const MapUnitHot& defender = unitsHot[targets[t]];
+
+            int distance = std::abs(defender.x - tileX) + std::abs(defender.y - tileY);
+            if (distance > attackRange) continue;
+
+            const CombatForecast& forecast = forecasts[t];
+            int dealt = std::min(forecast.damage * forecast.hits, defender.hp);
+            int score = (dealt * forecast.hitChance) / 10;      // Expected damage
+            if (forecast.damage * forecast.hits >= defender.hp) score += 100;  // Kills first
+            score += (defender.maxHp - defender.hp);            // Prefer wounded targets
+            score -= cost[index];                               // Shorter moves break ties
+
+            if (score > bestScore) {
+                bestScore = score;
+                action.moveX = tileX;
+                action.moveY = tileY;
+                action.targetIndex = targets[t];
+                action.score = score;
+            }
+        }
+
+        // Fallback while no attack is possible: close in on the nearest player
+        if (bestScore < 0) {
+            for (int target : targets) {
+                const MapUnitHot& defender = unitsHot[target];
+                int distance = std::abs(defender.x - tileX) + std::abs(defender.y - tileY);
+                if (distance < fallbackDistance) {
+                    fallbackDistance = distance;
+                    action.moveX = tileX;
+                    action.moveY = tileY;
+                }
+            }
+        }
+    }
+
+    return action;
+}
+
+std::vector<EnemyAction> EnemyStrategies::DecidePhase(const EnemyPhaseView& view,
+                                                      const std::vector<MapUnitHot>& unitsHot,
+                                                      const std::vector<CombatantStats>& stats,
+                                                      const std::vector<int>& attackRangeByUnit) {
+    std::vector<int> enemies;
+    for (int i = 0; i < (int)unitsHot.size(); i++) {
+        if (!unitsHot[i].isPlayer && unitsHot[i].hp > 0) {
+            enemies.push_back(i);
+        }
+    }
+
+    std::vector<EnemyAction> actions(enemies.size());
+    if (enemies.empty()) {
+        return actions;
+    }
+
+    // Worker pool: split the enemy list into contiguous chunks, one task
+    // per hardware thread. Every worker writes only its own slots, and
+    // the result vector stays in unit-index order regardless of which
+    // worker finishes first, so replays are reproducible.
+    unsigned workerCount = std::thread::hardware_concurrency();
+    if (workerCount == 0) workerCount = 1;
+    workerCount = std::min(workerCount, (unsigned)enemies.size());
+
+    std::vector<std::future<void>> workers;
+    size_t chunkSize = (enemies.size() + workerCount - 1) / workerCount;
+
+    for (unsigned w = 0; w < workerCount; w++) {
+        size_t begin = w * chunkSize;
+        size_t end = std::min(begin + chunkSize, enemies.size());
+        if (begin >= end) break;
+
+        workers.push_back(std::async(std::launch::async, [&, begin, end]() {
+            for (size_t i = begin; i < end; i++) {
+                int unitIndex = enemies[i];
+                int range = (unitIndex < (int)attackRangeByUnit.size())
+                                ? attackRangeByUnit[unitIndex] : 1;
+                actions[i] = DecideUnit(unitIndex, view, unitsHot, stats, range);
+            }
+        }));
+    }
+
+    for (auto& worker : workers) {
+        worker.wait();
+    }
+
+    return actions;
+}
+
+} // namespace Lehran
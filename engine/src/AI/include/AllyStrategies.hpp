@@ -0,0 +1,26 @@
+#pragma once
+
+#include "EnemyStrategies.hpp"
+
+namespace Lehran {
+
+/**
+ * Player-phase decision engine for auto-battle. Player units under AI
+ * control use the same candidate enumeration and scoring as the enemy
+ * phase, just with the sides reversed, so auto-battled units fight
+ * exactly as well as the enemies they face.
+ */
+class AllyStrategies {
+public:
+    /**
+     * Decide every living player unit's action for this phase.
+     * Parameters mirror EnemyStrategies::DecidePhase; the returned
+     * actions are in ascending player unit-index order.
+     */
+    static std::vector<EnemyAction> DecidePhase(const EnemyPhaseView& view,
+                                                const std::vector<MapUnitHot>& unitsHot,
+                                                const std::vector<CombatantStats>& stats,
+                                                const std::vector<int>& attackRangeByUnit);
+};
+
+} // namespace Lehran
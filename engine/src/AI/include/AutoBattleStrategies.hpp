@@ -0,0 +1,75 @@
+#pragma once
+
+#include "AllyStrategies.hpp"
+#include "EnemyStrategies.hpp"
+#include <cstdint>
+
+namespace Lehran {
+
+/**
+ * Outcome of one simulated battle.
+ */
+struct AutoBattleResult {
+    enum Outcome { PLAYER_WIN, ENEMY_WIN, TURN_LIMIT };
+
+    Outcome outcome;
+    int turns;            // Turns elapsed (1-based, includes the final one)
+    int playerSurvivors;  // Living player units at the end
+    int enemySurvivors;   // Living enemy units at the end
+    int playerHpLost;     // Total HP lost by player units over the battle
+
+    AutoBattleResult() : outcome(TURN_LIMIT), turns(0), playerSurvivors(0),
+                         enemySurvivors(0), playerHpLost(0) {}
+};
+
+/**
+ * Headless fast-forward battle simulation. Runs whole battles over the
+ * same phase snapshot (EnemyPhaseView + hot units + resolved stats) that
+ * the live AI uses - no MapManager, renderer, vsync or SDL_Delay anywhere
+ * in the loop - so chapters can be balance-tested by running thousands of
+ * simulations overnight. Player phases are decided by AllyStrategies,
+ * enemy phases by EnemyStrategies, and combat rolls come from a seeded
+ * generator so a (map, seed) pair always replays the same battle.
+ */
+class AutoBattleStrategies {
+public:
+    /**
+     * Simulate a battle to completion at maximum speed.
+     * @param view Map snapshot (terrain costs + starting occupancy)
+     * @param unitsHot Starting hot unit array (copied; caller's is untouched)
+     * @param stats Weapon-resolved combat stats per unit index
+     * @param attackRangeByUnit Max attack range per unit index
+     * @param maxTurns Turn cap before declaring TURN_LIMIT
+     * @param seed Combat RNG seed; same seed replays the same battle
+     */
+    static AutoBattleResult Simulate(const EnemyPhaseView& view,
+                                     const std::vector<MapUnitHot>& unitsHot,
+                                     const std::vector<CombatantStats>& stats,
+                                     const std::vector<int>& attackRangeByUnit,
+                                     int maxTurns = 50,
+                                     uint32_t seed = 1);
+
+    /**
+     * Decide and apply one phase in-place on live simulation state.
+     * Exposed so in-game auto-battle can run a single player phase
+     * against MapManager-derived snapshots and animate the results.
+     * @param playerPhase true = AllyStrategies, false = EnemyStrategies
+     * @param rngState Combat RNG state, advanced by every roll
+     * @return HP dealt to player units during the phase
+     */
+    static int RunPhase(bool playerPhase,
+                        EnemyPhaseView& view,
+                        std::vector<MapUnitHot>& units,
+                        const std::vector<CombatantStats>& stats,
+                        const std::vector<int>& attackRangeByUnit,
+                        uint32_t& rngState);
+
+private:
+    static int ResolveCombat(int attackerIndex, int defenderIndex,
+                             std::vector<MapUnitHot>& units,
+                             const std::vector<CombatantStats>& stats,
+                             const std::vector<int>& attackRangeByUnit,
+                             uint32_t& rngState);
+};
+
+} // namespace Lehran
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "MapManager.hpp"
+#include "DamageCalculation.hpp"
+#include <vector>
+
+namespace Lehran {
+
+/**
+ * Read-only snapshot of the map the AI workers evaluate against.
+ * Built once per enemy phase on the main thread so the workers never
+ * touch live MapManager state.
+ */
+struct EnemyPhaseView {
+    int width;
+    int height;
+    std::vector<int> tileCost;   // Entry cost per tile, 0 = impassable
+    std::vector<int> occupancy;  // Unit index per tile, -1 = empty
+
+    EnemyPhaseView() : width(0), height(0) {}
+};
+
+/**
+ * One decided enemy action: move to (moveX, moveY), then attack
+ * targetIndex (-1 = just reposition).
+ */
+struct EnemyAction {
+    int unitIndex;    // Enemy making the move
+    int moveX, moveY; // Destination tile
+    int targetIndex;  // Unit index to attack after moving, -1 = none
+    int score;        // Evaluation score (higher = better)
+
+    EnemyAction() : unitIndex(-1), moveX(0), moveY(0), targetIndex(-1), score(0) {}
+};
+
+/**
+ * Enemy-phase decision engine. For each enemy it enumerates reachable
+ * tiles (Dijkstra over terrain costs) x attackable player targets,
+ * scores every candidate with the damage forecast, and picks the best.
+ * Units are independent given the phase snapshot, so their candidate
+ * sets are evaluated in parallel on a worker pool; results come back in
+ * unit-index order so the same inputs always produce the same phase.
+ */
+class EnemyStrategies {
+public:
+    /**
+     * Decide every living enemy's action for this phase.
+     * @param view Map snapshot (terrain costs + occupancy)
+     * @param unitsHot Hot unit array (positions, stats, flags)
+     * @param stats Weapon-resolved combat stats per unit index
+     * @param attackRangeByUnit Max attack range per unit index
+     * @return Actions in ascending enemy unit-index order
+     */
+    static std::vector<EnemyAction> DecidePhase(const EnemyPhaseView& view,
+                                                const std::vector<MapUnitHot>& unitsHot,
+                                                const std::vector<CombatantStats>& stats,
+                                                const std::vector<int>& attackRangeByUnit);
+
+private:
+    static EnemyAction DecideUnit(int unitIndex, const EnemyPhaseView& view,
+                                  const std::vector<MapUnitHot>& unitsHot,
+                                  const std::vector<CombatantStats>& stats,
+                                  int attackRange);
+};
+
+} // namespace Lehran
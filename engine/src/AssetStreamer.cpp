@@ -0,0 +1,165 @@
+#include "AssetStreamer.hpp"
+#include "TextureManager.hpp"
+#include "json.hpp"
+#include <SDL_image.h>
+#include <fstream>
+#include <iostream>
+
+using json = nlohmann::json;
+
+AssetStreamer::AssetStreamer(TextureManager* textureManager)
+    : textureManager(textureManager), running(true), totalQueued(0), totalFinished(0) {
+    worker = std::thread(&AssetStreamer::WorkerLoop, this);
+}
+
+AssetStreamer::~AssetStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        running = false;
+    }
+    queueCondition.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    // Free any surfaces that were loaded but never consumed
+    std::lock_guard<std::mutex> lock(doneMutex);
+    for (auto& asset : doneAssets) {
+        if (asset.surface) {
+            SDL_FreeSurface(asset.surface);
+        }
+    }
+    doneAssets.clear();
+}
+
+bool AssetStreamer::IsImagePath(const std::string& path) {
+    size_t dot = path.rfind('.');
+    if (dot == std::string::npos) return false;
+    std::string ext = path.substr(dot);
+    return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp";
+}
+
+void AssetStreamer::WorkerLoop() {
+    while (true) {
+        std::string path;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCondition.wait(lock, [this] { return !running || !pendingPaths.empty(); });
+            if (!running && pendingPaths.empty()) {
+                return;
+            }
+            path = pendingPaths.front();
+            pendingPaths.pop_front();
+        }
+
+        SDL_Surface* surface = nullptr;
+        if (IsImagePath(path)) {
+            surface = IMG_Load(path.c_str());
+            if (!surface) {
+                std::cerr << "WARNING: Streamer failed to load " << path << ": "
+                          << IMG_GetError() << std::endl;
+            }
+        } else {
+            // Non-image asset (music, data): read it through once so the
+            // OS cache is warm when the real loader opens it
+            std::ifstream file(path, std::ios::binary);
+            if (file.is_open()) {
+                char buffer[16384];
+                while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0) {
+                    if (file.gcount() < (std::streamsize)sizeof(buffer)) break;
+                }
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(doneMutex);
+            doneAssets.push_back({path, surface});
+        }
+    }
+}
+
+void AssetStreamer::QueueFile(const std::string& path) {
+    if (path.empty()) return;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        pendingPaths.push_back(path);
+    }
+    totalQueued++;
+    queueCondition.notify_one();
+}
+
+bool AssetStreamer::QueueMapPreload(const std::string& mapFile) {
+    try {
+        std::ifstream file(mapFile);
+        if (!file.is_open()) {
+            std::cerr << "WARNING: Could not open map for preload: " << mapFile << std::endl;
+            return false;
+        }
+
+        json mapData;
+        file >> mapData;
+
+        // Tile textures come from the atlas file the map references
+        if (mapData.contains("atlas")) {
+            std::string atlasFile = mapData["atlas"];
+            std::ifstream atlasStream(atlasFile);
+            if (atlasStream.is_open()) {
+                json atlasData;
+                atlasStream >> atlasData;
+                if (atlasData.contains("tiles")) {
+                    for (const auto& tileJson : atlasData["tiles"]) {
+                        QueueFile(tileJson.value("texture", ""));
+                    }
+                }
+            }
+        }
+
+        // Unit sprites
+        if (mapData.contains("units")) {
+            for (const auto& unitJson : mapData["units"]) {
+                QueueFile(unitJson.value("sprite", ""));
+            }
+        }
+
+        // Map music (warm-up read; Mix_Music streams from disk at playback)
+        QueueFile(mapData.value("music", ""));
+
+        // Explicit preload manifest for anything the map knows it needs
+        // beyond tiles and sprites (backgrounds, portraits, sound effects)
+        if (mapData.contains("preload")) {
+            for (const auto& path : mapData["preload"]) {
+                QueueFile(path.get<std::string>());
+            }
+        }
+
+        std::cout << "Queued preload for map: " << mapFile << std::endl;
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "WARNING: Failed to parse map for preload: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+void AssetStreamer::Update(int maxUploads) {
+    std::vector<LoadedAsset> finished;
+    {
+        std::lock_guard<std::mutex> lock(doneMutex);
+        finished.swap(doneAssets);
+    }
+
+    for (auto& asset : finished) {
+        if (asset.surface) {
+            textureManager->StoreStreamedSurface(asset.path, asset.surface);
+        }
+        totalFinished++;
+    }
+
+    // Budgeted GPU uploads so a big preload doesn't hitch a single frame
+    textureManager->UploadStreamedSurfaces(maxUploads);
+}
+
+float AssetStreamer::GetProgress() const {
+    int queued = totalQueued.load();
+    if (queued == 0) return 1.0f;
+    return (float)totalFinished.load() / (float)queued;
+}
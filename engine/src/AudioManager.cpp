@@ -0,0 +1,222 @@
+#include "AudioManager.hpp"
+#include <iostream>
+
+AudioManager::AudioManager(bool audioAvailable)
+    : audioAvailable(audioAvailable), currentMusic(nullptr),
+      running(false), loadedMusic(nullptr), queuedMusic(nullptr),
+      fadingOut(false), crossfadeMs(600) {
+    if (!audioAvailable) {
+        return;
+    }
+
+    // Plenty of mixing channels so rapid-fire SFX never steal each other
+    Mix_AllocateChannels(16);
+
+    running = true;
+    worker = std::thread(&AudioManager::WorkerLoop, this);
+}
+
+AudioManager::~AudioManager() {
+    if (running) {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            running = false;
+        }
+        queueCondition.notify_one();
+        worker.join();
+    }
+
+    if (audioAvailable) {
+        Mix_HaltMusic();
+        Mix_HaltChannel(-1);
+    }
+
+    if (loadedMusic) Mix_FreeMusic(loadedMusic);
+    if (queuedMusic) Mix_FreeMusic(queuedMusic);
+    if (currentMusic) Mix_FreeMusic(currentMusic);
+
+    for (auto& [id, chunk] : sfxPool) {
+        Mix_FreeChunk(chunk);
+    }
+    sfxPool.clear();
+}
+
+void AudioManager::WorkerLoop() {
+    while (true) {
+        std::string path;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCondition.wait(lock, [this]() {
+                return !running || !requestedPath.empty();
+            });
+            if (!running) {
+                return;
+            }
+            path = std::move(requestedPath);
+            requestedPath.clear();
+        }
+
+        // The slow part: file I/O and decoder setup, off the main thread
+        Mix_Music* music = Mix_LoadMUS(path.c_str());
+        if (!music) {
+            std::cerr << "ERROR: Failed to load music " << path << ": " << Mix_GetError() << std::endl;
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(doneMutex);
+        if (loadedMusic) {
+            // A newer request finished first; drop the stale track
+            Mix_FreeMusic(loadedMusic);
+        }
+        loadedMusic = music;
+        loadedPath = path;
+    }
+}
+
+void AudioManager::PreloadSFX(const json& audioAssignments) {
+    if (!audioAvailable) {
+        return;
+    }
+
+    // Engine built-ins that gameplay code plays by id
+    LoadSFX("cursor_move", "assets/sfx/cursor_move.ogg");
+
+    // Project-assigned sounds: { "sfx": { "<id>": "<file under assets/>" } }
+    if (audioAssignments.contains("sfx") && audioAssignments["sfx"].is_object()) {
+        for (auto& [id, file] : audioAssignments["sfx"].items()) {
+            if (file.is_string()) {
+                std::string name = file;
+                if (!name.empty()) {
+                    LoadSFX(id, "assets/" + name);
+                }
+            }
+        }
+    }
+
+    std::cout << "SFX pool ready: " << sfxPool.size() << " sounds decoded" << std::endl;
+}
+
+bool AudioManager::LoadSFX(const std::string& id, const std::string& path) {
+    if (!audioAvailable || sfxPool.count(id)) {
+        return false;
+    }
+
+    Mix_Chunk* chunk = Mix_LoadWAV(path.c_str());
+    if (!chunk) {
+        std::cerr << "WARNING: Failed to load SFX " << path << ": " << Mix_GetError() << std::endl;
+        return false;
+    }
+
+    sfxPool[id] = chunk;
+    return true;
+}
+
+void AudioManager::PlaySFX(const std::string& id) {
+    if (!audioAvailable) {
+        return;
+    }
+
+    auto it = sfxPool.find(id);
+    if (it != sfxPool.end()) {
+        Mix_PlayChannel(-1, it->second, 0);
+    }
+}
+
+void AudioManager::PlayMusic(const std::string& path, int fadeMs) {
+    if (!audioAvailable) {
+        return;
+    }
+
+    if (path.empty()) {
+        StopMusic(fadeMs);
+        return;
+    }
+
+    // Already playing (or already on its way in)
+    if (path == currentMusicPath && Mix_PlayingMusic()) {
+        return;
+    }
+    if (path == targetPath) {
+        return;
+    }
+
+    targetPath = path;
+    crossfadeMs = fadeMs;
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        requestedPath = path;
+    }
+    queueCondition.notify_one();
+}
+
+void AudioManager::StopMusic(int fadeMs) {
+    if (!audioAvailable) {
+        return;
+    }
+
+    targetPath.clear();
+    currentMusicPath.clear();
+    if (queuedMusic) {
+        Mix_FreeMusic(queuedMusic);
+        queuedMusic = nullptr;
+    }
+    if (Mix_PlayingMusic()) {
+        Mix_FadeOutMusic(fadeMs);
+        fadingOut = true;
+    }
+}
+
+void AudioManager::Update() {
+    if (!audioAvailable) {
+        return;
+    }
+
+    // Collect a finished background load, discarding it if a newer
+    // request superseded it while it was decoding
+    {
+        std::lock_guard<std::mutex> lock(doneMutex);
+        if (loadedMusic) {
+            if (loadedPath == targetPath) {
+                if (queuedMusic) {
+                    Mix_FreeMusic(queuedMusic);
+                }
+                queuedMusic = loadedMusic;
+                queuedPath = loadedPath;
+            } else {
+                Mix_FreeMusic(loadedMusic);
+            }
+            loadedMusic = nullptr;
+        }
+    }
+
+    if (!queuedMusic) {
+        return;
+    }
+
+    // Handover: fade the old track out, then fade the new one in once
+    // the channel is free. Mix only plays one music at a time, so the
+    // crossfade is a back-to-back fade pair.
+    if (Mix_PlayingMusic()) {
+        if (!fadingOut) {
+            Mix_FadeOutMusic(crossfadeMs);
+            fadingOut = true;
+        }
+        return;
+    }
+
+    if (currentMusic) {
+        Mix_FreeMusic(currentMusic);
+    }
+    currentMusic = queuedMusic;
+    currentMusicPath = queuedPath;
+    queuedMusic = nullptr;
+    fadingOut = false;
+
+    if (Mix_FadeInMusic(currentMusic, -1, crossfadeMs) == -1) {
+        std::cerr << "ERROR: Failed to play music " << currentMusicPath << ": " << Mix_GetError() << std::endl;
+        currentMusicPath.clear();
+    } else {
+        std::cout << "Now playing: " << currentMusicPath << std::endl;
+    }
+}
@@ -0,0 +1,79 @@
+#include "DamageCalculation.hpp"
+
+namespace Lehran {
+
+namespace {
+    int Clamp100(int value) {
+        if (value < 0) return 0;
+        if (value > 100) return 100;
+        return value;
+    }
+}
+
+int DamageCalculation::AttackSpeed(const CombatantStats& stats) {
+    int burden = stats.weight - stats.con;
+    if (burden < 0) burden = 0;
+    return stats.spd - burden;
+}
+
+void DamageCalculation::ForecastBatch(const CombatantStats* attackers,
+                                      const CombatantStats* defenders,
+                                      CombatForecast* out,
+                                      size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        const CombatantStats& a = attackers[i];
+        const CombatantStats& d = defenders[i];
+
+        // Damage: attack power (might + str or mag) against def or res.
+        // magical is 0/1 so both sides compute without branching.
+        int power = a.might + a.str * (1 - a.magical) + a.mag * a.magical;
+        int mitigation = d.def * (1 - a.magical) + d.res * a.magical;
+        int damage = power - mitigation;
+        if (damage < 0) damage = 0;
+
+        // Accuracy: weapon hit + skill, against attack-speed avoid
+        int attackSpeedA = AttackSpeed(a);
+        int attackSpeedD = AttackSpeed(d);
+        int accuracy = a.hit + a.skl * 2 + a.lck / 2;
+        int avoid = attackSpeedD * 2 + d.lck;
+
+        // Crit: weapon crit + skill, against luck
+        int critRate = a.crit + a.skl / 2 - d.lck;
+
+        out[i].damage = damage;
+        out[i].hitChance = Clamp100(accuracy - avoid);
+        out[i].critChance = Clamp100(critRate);
+        out[i].hits = (attackSpeedA >= attackSpeedD + 5) ? 2 : 1;
+    }
+}
+
+CombatForecast DamageCalculation::Forecast(const CombatantStats& attacker,
+                                           const CombatantStats& defender) {
+    CombatForecast result;
+    ForecastBatch(&attacker, &defender, &result, 1);
+    return result;
+}
+
+CombatantStats DamageCalculation::MakeStats(const MapUnitHot& unit, const WeaponData& weapon) {
+    CombatantStats stats;
+    stats.hp = unit.hp;
+    stats.str = unit.str;
+    stats.mag = unit.mag;
+    stats.skl = unit.skl;
+    stats.spd = unit.spd;
+    stats.lck = unit.lck;
+    stats.def = unit.def;
+    stats.res = unit.res;
+    stats.con = unit.con;
+    stats.might = weapon.might;
+    stats.weight = weapon.weight;
+    stats.hit = weapon.hit;
+    stats.crit = weapon.crit;
+
+    // Tome types target res; everything else is physical
+    stats.magical = (weapon.type == "anima" || weapon.type == "light" ||
+                     weapon.type == "dark" || weapon.type == "tome") ? 1 : 0;
+    return stats;
+}
+
+} // namespace Lehran
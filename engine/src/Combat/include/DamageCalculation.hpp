@@ -0,0 +1,76 @@
+#pragma once
+
+#include "MapManager.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace Lehran {
+
+/**
+ * Flat stat block for one combatant in a forecast batch. Weapon stats
+ * are resolved into it up front (MakeStats) so the kernel itself is
+ * pure integer math over arrays - no JSON or string lookups per pair.
+ */
+struct CombatantStats {
+    int hp;
+    int str, mag, skl, spd, lck, def, res, con;
+    int might;       // Equipped weapon might
+    int weight;      // Equipped weapon weight
+    int hit;         // Equipped weapon hit
+    int crit;        // Equipped weapon crit
+    int magical;     // 1 = mag vs res, 0 = str vs def
+
+    CombatantStats() : hp(0), str(0), mag(0), skl(0), spd(0), lck(0),
+                       def(0), res(0), con(0), might(0), weight(0),
+                       hit(0), crit(0), magical(0) {}
+};
+
+/**
+ * Forecast for one attacker/defender pair.
+ */
+struct CombatForecast {
+    int damage;      // Damage per hit
+    int hitChance;   // 0-100
+    int critChance;  // 0-100
+    int hits;        // 1, or 2 when doubling
+
+    CombatForecast() : damage(0), hitChance(0), critChance(0), hits(1) {}
+};
+
+/**
+ * Batch damage-forecast kernel. The enemy AI needs thousands of
+ * forecasts per phase and the danger-zone overlay sweeps the whole
+ * map, so the primary API takes flat arrays of N pairs in one call;
+ * the loop body is branch-light integer math the compiler can
+ * auto-vectorize.
+ */
+class DamageCalculation {
+public:
+    /**
+     * Forecast count attacker/defender pairs: out[i] is attackers[i]
+     * striking defenders[i].
+     */
+    static void ForecastBatch(const CombatantStats* attackers,
+                              const CombatantStats* defenders,
+                              CombatForecast* out,
+                              size_t count);
+
+    /**
+     * One-pair convenience wrapper over the batch kernel.
+     */
+    static CombatForecast Forecast(const CombatantStats& attacker,
+                                   const CombatantStats& defender);
+
+    /**
+     * Attack speed: spd minus weapon weight overflowing con.
+     */
+    static int AttackSpeed(const CombatantStats& stats);
+
+    /**
+     * Resolve a hot unit plus its equipped weapon into a flat stat
+     * block. The single place weapon type strings are inspected.
+     */
+    static CombatantStats MakeStats(const MapUnitHot& unit, const WeaponData& weapon);
+};
+
+} // namespace Lehran
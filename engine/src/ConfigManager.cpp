@@ -18,11 +18,17 @@ ConfigManager::ConfigManager() {
     displaySettings.nativeDisplayHeight = 1080;
     displaySettings.renderScale = 0.6667f;
     displaySettings.selectedResolutionIndex = 0;
+    displaySettings.fpsCap = 60;
+    displaySettings.textureBudgetMB = 256;
 
     audioSettings.masterVolume = 80;
     audioSettings.musicVolume = 70;
     audioSettings.sfxVolume = 80;
     audioSettings.voiceVolume = 80;
+
+    // At 60 ticks/sec: 0.25s before repeat kicks in, then 20 tiles/sec
+    inputSettings.cursorInitialDelayTicks = 15;
+    inputSettings.cursorRepeatTicks = 3;
 }
 
 ConfigManager::~ConfigManager() {
@@ -59,6 +65,26 @@ bool ConfigManager::LoadEngineSettings(const std::string& configPath) {
                         if (modeValue >= 0 && modeValue <= 2) {
                             displaySettings.windowMode = static_cast<WindowMode>(modeValue);
                         }
+                    } else if (key == "fps_cap") {
+                        int capValue = std::stoi(value);
+                        if (capValue >= 0) {
+                            displaySettings.fpsCap = std::min(capValue, 240);
+                        }
+                    } else if (key == "texture_budget_mb") {
+                        int budgetValue = std::stoi(value);
+                        if (budgetValue >= 0) {
+                            displaySettings.textureBudgetMB = std::min(budgetValue, 4096);
+                        }
+                    } else if (key == "cursor_initial_delay_ticks") {
+                        int delayValue = std::stoi(value);
+                        if (delayValue >= 0) {
+                            inputSettings.cursorInitialDelayTicks = std::min(delayValue, 120);
+                        }
+                    } else if (key == "cursor_repeat_ticks") {
+                        int repeatValue = std::stoi(value);
+                        if (repeatValue >= 1) {
+                            inputSettings.cursorRepeatTicks = std::min(repeatValue, 60);
+                        }
                     } else if (key == "master_volume") {
                         audioSettings.masterVolume = std::stoi(value);
                     } else if (key == "music_volume") {
@@ -114,6 +140,11 @@ void ConfigManager::SaveEngineSettings(const std::string& configPath) {
             settingsFile << "window_height=" << displaySettings.windowHeight << "\n";
             settingsFile << "window_mode=" << static_cast<int>(displaySettings.windowMode) << "\n";
             settingsFile << "vsync=1\n";
+            settingsFile << "fps_cap=" << displaySettings.fpsCap << "\n";
+            settingsFile << "texture_budget_mb=" << displaySettings.textureBudgetMB << "\n";
+            settingsFile << "\n[Input]\n";
+            settingsFile << "cursor_initial_delay_ticks=" << inputSettings.cursorInitialDelayTicks << "\n";
+            settingsFile << "cursor_repeat_ticks=" << inputSettings.cursorRepeatTicks << "\n";
             settingsFile << "\n[Audio]\n";
             settingsFile << "master_volume=" << audioSettings.masterVolume << "\n";
             settingsFile << "music_volume=" << audioSettings.musicVolume << "\n";
@@ -149,6 +180,14 @@ void ConfigManager::SetResolutionIndex(int index) {
     SetWindowSize(width, height);
 }
 
+void ConfigManager::SetFPSCap(int cap) {
+    displaySettings.fpsCap = std::clamp(cap, 0, 240);
+}
+
+void ConfigManager::SetTextureBudgetMB(int megabytes) {
+    displaySettings.textureBudgetMB = std::clamp(megabytes, 0, 4096);
+}
+
 void ConfigManager::SetMasterVolume(int volume) {
     audioSettings.masterVolume = std::clamp(volume, 0, 100);
 }
@@ -3,17 +3,35 @@
 #include <sstream>
 
 DialogueSystem::DialogueSystem(SDL_Renderer* renderer, TTF_Font* fontMedium,
-                               TTF_Font* fontSmall, TextureManager* textureManager)
+                               TTF_Font* fontSmall, TextureManager* textureManager,
+                               Lehran::TextCache* textCache)
     : renderer(renderer), fontMedium(fontMedium), fontSmall(fontSmall),
-      textureManager(textureManager), currentLineIndex(0), isActive(false),
+      textureManager(textureManager), textCache(textCache), currentLineIndex(0), isActive(false),
       waitingForInput(true), textRevealTimer(0.0f), revealedChars(0),
-      instantText(true), selectedChoice(0), showingChoices(false) {
+      instantText(true), selectedChoice(0), showingChoices(false),
+      speakerTexture(nullptr), speakerWidth(0), speakerHeight(0), cachedLineIndex(-1) {
+}
+
+DialogueSystem::~DialogueSystem() {
+    ClearLineCache();
+    ClearChoiceCache();
 }
 
 void DialogueSystem::LoadDialogue(const std::vector<DialogueLine>& lines) {
     dialogueLines = lines;
     currentLineIndex = 0;
     showingChoices = false;
+    ClearLineCache();
+    ClearChoiceCache();
+
+    // Wrap every line up front: this is the only place the wrap
+    // measurement (one TTF size call per word) runs for a scene
+    wrappedCache.clear();
+    wrappedCache.reserve(dialogueLines.size());
+    for (const DialogueLine& line : dialogueLines) {
+        wrappedCache.push_back(WrapText(line.text, fontSmall, TEXT_MAX_WIDTH));
+    }
+
     std::cout << "Loaded " << dialogueLines.size() << " dialogue lines" << std::endl;
 }
 
@@ -35,9 +53,83 @@ void DialogueSystem::Stop() {
     isActive = false;
     currentLineIndex = 0;
     showingChoices = false;
+    ClearLineCache();
+    ClearChoiceCache();
     std::cout << "Dialogue stopped" << std::endl;
 }
 
+void DialogueSystem::ClearLineCache() {
+    for (RowCache& row : rowCache) {
+        if (row.texture) SDL_DestroyTexture(row.texture);
+    }
+    rowCache.clear();
+    if (speakerTexture) {
+        SDL_DestroyTexture(speakerTexture);
+        speakerTexture = nullptr;
+    }
+    speakerWidth = 0;
+    speakerHeight = 0;
+    cachedLineIndex = -1;
+}
+
+void DialogueSystem::ClearChoiceCache() {
+    for (ChoiceCache& choice : choiceCache) {
+        if (choice.normal) SDL_DestroyTexture(choice.normal);
+        if (choice.selected) SDL_DestroyTexture(choice.selected);
+    }
+    choiceCache.clear();
+}
+
+SDL_Texture* DialogueSystem::CreateTextTexture(const std::string& text, TTF_Font* font,
+                                               SDL_Color color, int& width, int& height) {
+    if (!font || text.empty()) return nullptr;
+
+    SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), color);
+    if (!surface) return nullptr;
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    width = surface->w;
+    height = surface->h;
+    SDL_FreeSurface(surface);
+    return texture;
+}
+
+void DialogueSystem::BuildLineCache() {
+    ClearLineCache();
+    if (currentLineIndex >= (int)dialogueLines.size() || currentLineIndex >= (int)wrappedCache.size()) {
+        return;
+    }
+
+    const DialogueLine& line = dialogueLines[currentLineIndex];
+
+    // One rasterization per wrapped row, plus the per-character prefix
+    // widths the reveal crop indexes into
+    size_t revealStart = 0;
+    for (const std::string& text : wrappedCache[currentLineIndex]) {
+        RowCache row;
+        row.text = text;
+        row.texture = CreateTextTexture(text, fontSmall, {255, 255, 255, 255}, row.width, row.height);
+        row.revealStart = revealStart;
+        revealStart += text.length() + 1;  // +1 for the space the wrap consumed
+
+        row.prefixWidths.resize(text.length() + 1, 0);
+        for (size_t n = 1; n <= text.length(); n++) {
+            int w = 0, h = 0;
+            TTF_SizeText(fontSmall, text.substr(0, n).c_str(), &w, &h);
+            row.prefixWidths[n] = w;
+        }
+
+        rowCache.push_back(std::move(row));
+    }
+
+    if (!line.speakerName.empty()) {
+        speakerTexture = CreateTextTexture(line.speakerName, fontMedium, {255, 255, 100, 255},
+                                           speakerWidth, speakerHeight);
+    }
+
+    cachedLineIndex = currentLineIndex;
+}
+
 void DialogueSystem::Update(float deltaTime) {
     if (!isActive || dialogueLines.empty()) return;
     
@@ -135,22 +227,39 @@ void DialogueSystem::Render() {
         }
     }
     
+    // Rebuild the row/speaker textures only when the line changes
+    if (cachedLineIndex != currentLineIndex) {
+        BuildLineCache();
+    }
+
     // Render speaker name
-    if (!currentLine.speakerName.empty()) {
+    if (speakerTexture) {
         int nameX = currentLine.portraitPath.empty() ? 126 : 342;
-        RenderText(currentLine.speakerName, nameX, DIALOGUE_BOX_Y + 36, fontMedium, 
-                   {255, 255, 100, 255}, false);
+        SDL_Rect nameRect = {nameX, DIALOGUE_BOX_Y + 36, speakerWidth, speakerHeight};
+        SDL_RenderCopy(renderer, speakerTexture, nullptr, &nameRect);
     }
-    
-    // Render dialogue text (wrapped)
+
+    // Render dialogue text: full rows copy whole, the row the typewriter
+    // is inside gets cropped to the revealed prefix width
     int textX = currentLine.portraitPath.empty() ? 126 : 342;
     int textY = DIALOGUE_BOX_Y + (currentLine.speakerName.empty() ? 54 : 99);
-    int maxWidth = 1400;
-    
-    std::vector<std::string> wrappedLines = WrapText(currentLine.text, fontSmall, maxWidth);
-    for (size_t i = 0; i < wrappedLines.size(); i++) {
-        RenderText(wrappedLines[i], textX, textY + (int)i * 45, fontSmall, 
-                   {255, 255, 255, 255}, false);
+
+    size_t reveal = instantText ? displayedText.length() : revealedChars;
+    for (size_t i = 0; i < rowCache.size(); i++) {
+        const RowCache& row = rowCache[i];
+        if (!row.texture || reveal <= row.revealStart) break;
+
+        size_t shown = reveal - row.revealStart;
+        if (shown > row.text.length()) shown = row.text.length();
+
+        SDL_Rect destRect = {textX, textY + (int)i * 45, row.width, row.height};
+        if (shown == row.text.length()) {
+            SDL_RenderCopy(renderer, row.texture, nullptr, &destRect);
+        } else {
+            SDL_Rect srcRect = {0, 0, row.prefixWidths[shown], row.height};
+            destRect.w = srcRect.w;
+            SDL_RenderCopy(renderer, row.texture, &srcRect, &destRect);
+        }
     }
     
     // Render "Press Enter to continue" prompt
@@ -175,12 +284,18 @@ void DialogueSystem::Render() {
             
             SDL_SetRenderDrawColor(renderer, 150, 150, 180, 255);
             SDL_RenderDrawRect(renderer, &choiceBox);
-            
-            SDL_Color textColor = ((int)i == selectedChoice) ? 
-                SDL_Color{255, 255, 100, 255} : SDL_Color{200, 200, 200, 255};
-            
-            RenderText(currentChoices[i].text, 960, choiceY + (int)i * 108 + 45, 
-                       fontSmall, textColor, true);
+
+            // Both color variants were rasterized when the choices opened
+            if (i < choiceCache.size()) {
+                const ChoiceCache& cached = choiceCache[i];
+                SDL_Texture* texture = ((int)i == selectedChoice) ? cached.selected : cached.normal;
+                if (texture) {
+                    SDL_Rect textRect = {960 - cached.width / 2,
+                                         choiceY + (int)i * 108 + 45 - cached.height / 2,
+                                         cached.width, cached.height};
+                    SDL_RenderCopy(renderer, texture, nullptr, &textRect);
+                }
+            }
         }
     }
 }
@@ -189,6 +304,19 @@ void DialogueSystem::ShowChoices(const std::vector<Choice>& choices) {
     currentChoices = choices;
     selectedChoice = 0;
     showingChoices = true;
+
+    // Rasterize both highlight states once; selection changes just swap
+    // which texture gets copied
+    ClearChoiceCache();
+    for (const Choice& choice : currentChoices) {
+        ChoiceCache cached;
+        cached.normal = CreateTextTexture(choice.text, fontSmall, {200, 200, 200, 255},
+                                          cached.width, cached.height);
+        cached.selected = CreateTextTexture(choice.text, fontSmall, {255, 255, 100, 255},
+                                            cached.width, cached.height);
+        choiceCache.push_back(cached);
+    }
+
     std::cout << "Showing " << choices.size() << " choices" << std::endl;
 }
 
@@ -199,32 +327,24 @@ bool DialogueSystem::HasSelectedChoice() const {
 void DialogueSystem::RenderText(const std::string& text, int x, int y, TTF_Font* font,
                                 SDL_Color color, bool centered) {
     if (!font || text.empty()) return;
-    
-    SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), color);
-    if (!surface) return;
-    
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (!texture) {
-        SDL_FreeSurface(surface);
-        return;
-    }
-    
+
+    int textWidth, textHeight;
+    SDL_Texture* texture = textCache->GetTexture(text, font, color, textWidth, textHeight);
+    if (!texture) return;
+
     SDL_Rect destRect;
-    destRect.w = surface->w;
-    destRect.h = surface->h;
-    
+    destRect.w = textWidth;
+    destRect.h = textHeight;
+
     if (centered) {
-        destRect.x = x - surface->w / 2;
-        destRect.y = y - surface->h / 2;
+        destRect.x = x - textWidth / 2;
+        destRect.y = y - textHeight / 2;
     } else {
         destRect.x = x;
         destRect.y = y;
     }
-    
+
     SDL_RenderCopy(renderer, texture, nullptr, &destRect);
-    
-    SDL_DestroyTexture(texture);
-    SDL_FreeSurface(surface);
 }
 
 std::vector<std::string> DialogueSystem::WrapText(const std::string& text, TTF_Font* font, int maxWidth) {
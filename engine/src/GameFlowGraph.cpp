@@ -0,0 +1,139 @@
+#include "GameFlowGraph.hpp"
+#include "StringInterner.hpp"
+#include <fstream>
+#include <iostream>
+
+namespace Lehran {
+
+namespace {
+    // Asset probe used during graph compilation; a miss is a content
+    // error, so the caller reports it with the owning scene id
+    bool FileExists(const std::string& path) {
+        std::ifstream probe(path, std::ios::binary);
+        return probe.is_open();
+    }
+}
+
+bool GameFlowGraph::Compile(const json& gameFlow) {
+    nodes.clear();
+    nodeIndex.clear();
+    startNode = -1;
+
+    if (!gameFlow.contains("game_start") || !gameFlow["game_start"].contains("new_game_scene")) {
+        std::cerr << "ERROR: No starting scene defined in game_flow.json" << std::endl;
+        return false;
+    }
+
+    // Walk the next_scene chain from the start, compiling each scene
+    // exactly once. CompileScene only recurses through nodeIndex, so
+    // cycles in the flow terminate naturally.
+    int errors = 0;
+    std::string startId = gameFlow["game_start"]["new_game_scene"];
+    int start = CompileScene(startId, errors);
+
+    if (errors > 0 || start < 0) {
+        std::cerr << "ERROR: Game flow validation failed with " << errors
+                  << " problem(s); fix the flow before shipping" << std::endl;
+        nodes.clear();
+        nodeIndex.clear();
+        return false;
+    }
+
+    startNode = start;
+    std::cout << "Compiled game flow: " << nodes.size() << " scene(s)" << std::endl;
+    return true;
+}
+
+int GameFlowGraph::CompileScene(const std::string& sceneId, int& errors) {
+    // The sentinel id is not a scene; it compiles to "no next node"
+    if (sceneId.empty() || sceneId == "return_to_title") {
+        return -1;
+    }
+
+    uint32_t id = StringInterner::Intern(sceneId);
+    auto existing = nodeIndex.find(id);
+    if (existing != nodeIndex.end()) {
+        return existing->second;
+    }
+
+    std::string scenePath = "data/scenes/" + sceneId + ".json";
+    json sceneData;
+    try {
+        std::ifstream sceneFile(scenePath);
+        if (!sceneFile.is_open()) {
+            std::cerr << "ERROR: Scene file not found: " << scenePath << std::endl;
+            errors++;
+            return -1;
+        }
+        sceneFile >> sceneData;
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: Failed to parse " << scenePath << ": " << e.what() << std::endl;
+        errors++;
+        return -1;
+    }
+
+    // Reserve this node's slot before following next_scene so loops in
+    // the flow resolve against it instead of recursing forever
+    int index = (int)nodes.size();
+    nodes.push_back(GameFlowNode());
+    nodeIndex[id] = index;
+
+    GameFlowNode node;
+    node.sceneId = id;
+
+    if (sceneData.contains("background")) {
+        node.background = "assets/" + sceneData["background"].get<std::string>();
+        if (!FileExists(node.background)) {
+            std::cerr << "ERROR: Scene '" << sceneId << "' references missing background: "
+                      << node.background << std::endl;
+            errors++;
+        }
+    }
+
+    if (sceneData.contains("music")) {
+        node.music = sceneData["music"].get<std::string>();
+        if (!FileExists("assets/" + node.music)) {
+            std::cerr << "ERROR: Scene '" << sceneId << "' references missing music: assets/"
+                      << node.music << std::endl;
+            errors++;
+        }
+    }
+
+    if (sceneData.contains("dialogue")) {
+        for (const auto& line : sceneData["dialogue"]) {
+            DialogueSystem::DialogueLine dialogueLine;
+            dialogueLine.speakerName = line.value("speaker", "");
+            dialogueLine.text = line.value("text", "");
+            dialogueLine.portraitPath = line.value("portrait", "");
+            dialogueLine.spriteLeft = line.value("sprite_left", "");
+            dialogueLine.spriteRight = line.value("sprite_right", "");
+            dialogueLine.flipSpriteLeft = line.value("flip_sprite_left", false);
+            dialogueLine.flipSpriteRight = line.value("flip_sprite_right", false);
+
+            // Dialogue image paths are used verbatim by the renderer
+            for (const std::string& path : {dialogueLine.portraitPath,
+                                            dialogueLine.spriteLeft,
+                                            dialogueLine.spriteRight}) {
+                if (!path.empty() && !FileExists(path)) {
+                    std::cerr << "ERROR: Scene '" << sceneId
+                              << "' references missing image: " << path << std::endl;
+                    errors++;
+                }
+            }
+
+            node.dialogue.push_back(std::move(dialogueLine));
+        }
+    }
+
+    node.nextNode = CompileScene(sceneData.value("next_scene", ""), errors);
+
+    nodes[index] = std::move(node);
+    return index;
+}
+
+int GameFlowGraph::FindNode(const std::string& sceneId) const {
+    auto it = nodeIndex.find(StringInterner::Intern(sceneId));
+    return it != nodeIndex.end() ? it->second : -1;
+}
+
+} // namespace Lehran
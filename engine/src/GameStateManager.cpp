@@ -1,5 +1,7 @@
 #include "GameStateManager.hpp"
+#include "GameFlowGraph.hpp"
 #include "SaveManager.hpp"
+#include "StringInterner.hpp"
 #include "SceneManager.hpp"
 #include "DialogueSystem.hpp"
 #include "SaveSlotScreen.hpp"
@@ -16,7 +18,9 @@ GameStateManager::GameStateManager()
       settingsScrollOffset(0),
       splashTimer(0.0f),
       saveScreenMode(SaveScreenMode::NEW_GAME),
-      currentSaveSlot(-1) {
+      currentSaveSlot(-1),
+      flowGraph(nullptr),
+      currentNodeIndex(-1) {
 }
 
 GameStateManager::~GameStateManager() {
@@ -44,7 +48,7 @@ void GameStateManager::UpdateSplashTimer(float deltaTime) {
     splashTimer += deltaTime;
 }
 
-void GameStateManager::StartGameFromSlot(int slotNumber, SaveManager* saveManager, const json& gameFlow) {
+void GameStateManager::StartGameFromSlot(int slotNumber, SaveManager* saveManager) {
     std::cout << "Starting game from slot " << slotNumber << std::endl;
     currentSaveSlot = slotNumber;
 
@@ -72,17 +76,19 @@ void GameStateManager::StartGameFromSlot(int slotNumber, SaveManager* saveManage
         std::cout << "Created new save in slot " << slotNumber << std::endl;
     }
 
-    // Get starting scene from game_flow.json
-    if (gameFlow.contains("game_start") && gameFlow["game_start"].contains("new_game_scene")) {
-        currentSceneId = gameFlow["game_start"]["new_game_scene"];
+    // Start at the compiled flow graph's entry node; any problem with
+    // the flow was already reported as a startup error by Compile
+    if (flowGraph && flowGraph->IsValid()) {
+        currentNodeIndex = flowGraph->GetStartNode();
+        currentSceneId = StringInterner::Lookup(flowGraph->GetNode(currentNodeIndex).sceneId);
         // Note: LoadScene will be called by the main engine after this returns
     } else {
-        std::cerr << "ERROR: No starting scene defined in game_flow.json!" << std::endl;
+        std::cerr << "ERROR: No valid game flow compiled; cannot start" << std::endl;
         currentState = GameState::STATE_TITLE;
     }
 }
 
-void GameStateManager::LoadScene(const std::string& sceneId, SceneManager* sceneManager, 
+void GameStateManager::LoadScene(const std::string& sceneId, SceneManager* sceneManager,
                                   DialogueSystem* dialogueSystem) {
     std::cout << "Loading scene: " << sceneId << std::endl;
 
@@ -92,6 +98,19 @@ void GameStateManager::LoadScene(const std::string& sceneId, SceneManager* scene
         return;
     }
 
+    // Scenes in the compiled flow graph need no file I/O or parsing here
+    if (flowGraph && flowGraph->IsValid()) {
+        int nodeIdx = flowGraph->FindNode(sceneId);
+        if (nodeIdx >= 0) {
+            LoadNode(nodeIdx, sceneManager, dialogueSystem);
+            return;
+        }
+    }
+
+    // Off-graph scene (dev/test menu entries): fall back to loading the
+    // scene file directly, the way all scenes used to load
+    currentNodeIndex = -1;
+
     // Load scene JSON file
     std::string scenePath = "data/scenes/" + sceneId + ".json";
     json sceneData;
@@ -139,6 +158,28 @@ void GameStateManager::LoadScene(const std::string& sceneId, SceneManager* scene
     }
 }
 
+void GameStateManager::LoadNode(int nodeIndex, SceneManager* sceneManager,
+                                 DialogueSystem* dialogueSystem) {
+    const GameFlowNode& node = flowGraph->GetNode(nodeIndex);
+    currentNodeIndex = nodeIndex;
+    currentSceneId = StringInterner::Lookup(node.sceneId);
+
+    // Transition to scene
+    currentState = GameState::STATE_SCENE;
+    sceneManager->StartTransition(SceneManager::TransitionType::FADE_FROM_BLACK, 1.0f);
+
+    if (!node.background.empty()) {
+        sceneManager->SetBackground(node.background);
+    }
+
+    if (!node.music.empty() && onLoadSceneMusic) {
+        onLoadSceneMusic(node.music);
+    }
+
+    dialogueSystem->LoadDialogue(node.dialogue);
+    // Dialogue will be started by the Update loop after transition completes
+}
+
 void GameStateManager::EndScene(SceneManager* sceneManager, DialogueSystem* dialogueSystem) {
     // Scene complete - check if there's a next scene or return to title
     std::cout << "Scene complete" << std::endl;
@@ -146,6 +187,22 @@ void GameStateManager::EndScene(SceneManager* sceneManager, DialogueSystem* dial
     dialogueSystem->Stop();
     sceneManager->ClearBackground();
 
+    // On-graph scenes advance by node index; no lookup, no file I/O
+    if (currentNodeIndex >= 0 && flowGraph) {
+        int next = flowGraph->GetNode(currentNodeIndex).nextNode;
+        if (next >= 0) {
+            LoadNode(next, sceneManager, dialogueSystem);
+        } else {
+            std::cout << "Returning to title screen" << std::endl;
+            currentNodeIndex = -1;
+            currentState = GameState::STATE_TITLE;
+            if (onLoadTitleMusic) {
+                onLoadTitleMusic();
+            }
+        }
+        return;
+    }
+
     // Load next scene or return to title
     if (!currentSceneId.empty() && currentSceneId != "return_to_title") {
         LoadScene(currentSceneId, sceneManager, dialogueSystem);
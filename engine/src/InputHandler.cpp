@@ -5,7 +5,12 @@
 namespace Lehran {
 
 InputHandler::InputHandler()
-    : saveSlotScreen(nullptr) {
+    : cursorInitialDelayTicks(15),
+      cursorRepeatTicks(3),
+      heldDX(0),
+      heldDY(0),
+      heldTicks(0),
+      saveSlotScreen(nullptr) {
 }
 
 InputHandler::~InputHandler() {
@@ -56,6 +61,57 @@ void InputHandler::HandleMouseWheel(int wheelY, GameState currentState) {
     }
 }
 
+void InputHandler::SetCursorRepeat(int initialDelayTicks, int repeatTicks) {
+    if (initialDelayTicks >= 0) cursorInitialDelayTicks = initialDelayTicks;
+    if (repeatTicks >= 1) cursorRepeatTicks = repeatTicks;
+}
+
+void InputHandler::PollHeldKeys(GameState currentState) {
+    // Only the map cursor uses held-key movement; everywhere else a reset
+    // keeps a key held across a state change from firing on arrival
+    if (currentState != GameState::STATE_MAP) {
+        heldDX = heldDY = heldTicks = 0;
+        return;
+    }
+
+    // While a menu is up, up/down are discrete navigation handled by
+    // HandleMapInput; holding a direction should not scroll the cursor
+    if ((onMapInventoryAction && onMapInventoryAction(-2000) == 1) ||
+        (onMapActionMenuAction && onMapActionMenuAction(-1000) == 1)) {
+        heldDX = heldDY = heldTicks = 0;
+        return;
+    }
+
+    const Uint8* keys = SDL_GetKeyboardState(nullptr);
+    int dx = 0;
+    int dy = 0;
+    if (keys[SDL_SCANCODE_LEFT] || keys[SDL_SCANCODE_A]) dx -= 1;
+    if (keys[SDL_SCANCODE_RIGHT] || keys[SDL_SCANCODE_D]) dx += 1;
+    if (keys[SDL_SCANCODE_UP] || keys[SDL_SCANCODE_W]) dy -= 1;
+    if (keys[SDL_SCANCODE_DOWN] || keys[SDL_SCANCODE_S]) dy += 1;
+
+    if (dx == 0 && dy == 0) {
+        heldDX = heldDY = heldTicks = 0;
+        return;
+    }
+
+    if (dx != heldDX || dy != heldDY) {
+        // Fresh press or direction change: move immediately, then wait
+        // out the initial delay before repeating
+        heldDX = dx;
+        heldDY = dy;
+        heldTicks = 0;
+        if (onMapCursorMove) onMapCursorMove(dx, dy);
+        return;
+    }
+
+    heldTicks++;
+    if (heldTicks >= cursorInitialDelayTicks &&
+        (heldTicks - cursorInitialDelayTicks) % cursorRepeatTicks == 0) {
+        if (onMapCursorMove) onMapCursorMove(dx, dy);
+    }
+}
+
 void InputHandler::HandleSplashInput(SDL_Keycode key) {
     // Splash screen auto-transitions, no input needed
 }
@@ -195,18 +251,15 @@ void InputHandler::HandleMapInput(SDL_Keycode key) {
         }
     }
     
-    // Normal map controls
-    if (key == SDLK_LEFT || key == SDLK_a) {
-        if (onMapCursorMove) onMapCursorMove(-1, 0);
-    } else if (key == SDLK_RIGHT || key == SDLK_d) {
-        if (onMapCursorMove) onMapCursorMove(1, 0);
-    } else if (key == SDLK_UP || key == SDLK_w) {
-        if (onMapCursorMove) onMapCursorMove(0, -1);
-    } else if (key == SDLK_DOWN || key == SDLK_s) {
-        if (onMapCursorMove) onMapCursorMove(0, 1);
-    } else if (key == SDLK_TAB) {
+    // Normal map controls. Cursor movement is intentionally absent here:
+    // it runs through PollHeldKeys each tick so held keys repeat at our
+    // configured rate instead of the OS key-repeat rate.
+    if (key == SDLK_TAB) {
         // Toggle unit info panel
         if (onMapToggleUnitInfo) onMapToggleUnitInfo();
+    } else if (key == SDLK_v) {
+        // Toggle enemy danger zone overlay
+        if (onMapToggleDangerZone) onMapToggleDangerZone();
     } else if (key == SDLK_RETURN || key == SDLK_SPACE || key == SDLK_z) {
         // Select unit or confirm movement
         if (onMapSelectAction) onMapSelectAction();
@@ -1,66 +1,199 @@
 #include "MapManager.hpp"
+#include "AudioManager.hpp"
 #include "ConfigManager.hpp"
+#include "EnemyStrategies.hpp"
+#include "SaveManager.hpp"
+#include "StringInterner.hpp"
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <fstream>
+#include <queue>
 
 namespace Lehran {
 
-MapManager::MapManager(SDL_Renderer* renderer, TextureManager* textureManager, ConfigManager* configManager, TTF_Font* font)
-    : renderer(renderer), textureManager(textureManager), configManager(configManager), font(font),
-      tileSize(32), mapWidth(0), mapHeight(0),
+// Binary map format (.lmap): little-endian structs written by
+// CompileMapBinary. Layer data is stored as raw int32 arrays so loading is
+// one block read per layer instead of element-by-element JSON traversal,
+// and all strings live in a shared table referenced by index.
+namespace {
+    const uint32_t LMAP_MAGIC = 0x4C4D4150;  // "LMAP"
+    const uint32_t LMAP_VERSION = 1;
+
+    // Layer data block-reads straight into MapLayer::data
+    static_assert(sizeof(int) == sizeof(int32_t), "lmap layer data assumes 32-bit int");
+
+    void WriteU8(std::ofstream& out, uint8_t value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void WriteU32(std::ofstream& out, uint32_t value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void WriteI32(std::ofstream& out, int32_t value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    uint8_t ReadU8(std::ifstream& in) {
+        uint8_t value = 0;
+        in.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    }
+
+    uint32_t ReadU32(std::ifstream& in) {
+        uint32_t value = 0;
+        in.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    }
+
+    int32_t ReadI32(std::ifstream& in) {
+        int32_t value = 0;
+        in.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    }
+}
+
+MapManager::MapManager(SDL_Renderer* renderer, TextureManager* textureManager, ConfigManager* configManager, TTF_Font* font, TextCache* textCache, AudioManager* audioManager)
+    : renderer(renderer), textureManager(textureManager), configManager(configManager), font(font), textCache(textCache),
+      audioManager(audioManager),
+      tileSize(32), mapWidth(0), mapHeight(0), turnNumber(1),
+      chunkCols(0), chunkRows(0), staticLayersDirty(false),
       cameraX(0), cameraY(0), scale(3.0f), cursorX(0), cursorY(0),
-      cursorTexture(nullptr), cursorSound(nullptr), showCursor(true),
-      selectedUnitIndex(-1), moveRangeTexture(nullptr), attackRangeTexture(nullptr),
+      showCursor(true),
+      selectedUnitIndex(-1),
       showActionMenu(false), selectedActionIndex(0), originalUnitX(0), originalUnitY(0),
       showInventoryMenu(false), selectedInventoryIndex(0), inventoryUnitIndex(-1),
       showDropConfirmation(false), originalEquippedIndex(-1),
-      showUnitInfo(false), unitInfoIndex(-1) {
-    // Load cursor texture
-    cursorTexture = textureManager->LoadTexture("assets/ui/cursor.png");
-    if (!cursorTexture) {
+      showUnitInfo(false), unitInfoIndex(-1),
+      showDangerZone(false) {
+    // Load cursor texture into the shared UI atlas
+    cursorMarker = textureManager->LoadIntoAtlas("assets/ui/cursor.png");
+    if (!cursorMarker.IsValid()) {
         std::cerr << "WARNING: Failed to load cursor texture" << std::endl;
     }
-    
+
     // Load range textures
-    moveRangeTexture = textureManager->LoadTexture("assets/ui/mov_range.png");
-    if (!moveRangeTexture) {
+    moveRangeMarker = textureManager->LoadIntoAtlas("assets/ui/mov_range.png");
+    if (!moveRangeMarker.IsValid()) {
         std::cerr << "WARNING: Failed to load movement range texture" << std::endl;
     }
-    
-    attackRangeTexture = textureManager->LoadTexture("assets/ui/attack_range.png");
-    if (!attackRangeTexture) {
+
+    attackRangeMarker = textureManager->LoadIntoAtlas("assets/ui/attack_range.png");
+    if (!attackRangeMarker.IsValid()) {
         std::cerr << "WARNING: Failed to load attack range texture" << std::endl;
     }
-    
-    // Load cursor sound effect
-    cursorSound = Mix_LoadWAV("assets/sfx/cursor_move.ogg");
-    if (!cursorSound) {
-        std::cerr << "WARNING: Failed to load cursor sound: " << Mix_GetError() << std::endl;
-    }
 }
 
 MapManager::~MapManager() {
+    DestroyStaticLayerCache();
     ClearAtlas();
     ClearMap();
-    if (cursorSound) {
-        Mix_FreeChunk(cursorSound);
-        cursorSound = nullptr;
-    }
 }
 
 void MapManager::ClearAtlas() {
     tileTypes.clear();
+    tileTypeLookup.clear();
     atlasPath.clear();
+    staticLayersDirty = true;
 }
 
 void MapManager::ClearMap() {
+    DestroyStaticLayerCache();
     layers.clear();
-    units.clear();
+    unitsHot.clear();
+    unitsCold.clear();
+    occupancyGrid.clear();
+    threatGridPerUnit.clear();
+    threatDirty.clear();
+    dangerGrid.clear();
+    animTable.clear();
+    animIndexBySheet.clear();
     mapName.clear();
     mapWidth = 0;
     mapHeight = 0;
 }
 
+void MapManager::DestroyStaticLayerCache() {
+    for (SDL_Texture* chunk : staticChunks) {
+        if (chunk) {
+            SDL_DestroyTexture(chunk);
+        }
+    }
+    staticChunks.clear();
+    chunkCols = 0;
+    chunkRows = 0;
+    staticLayersDirty = true;
+}
+
+void MapManager::RebuildStaticLayerCache() {
+    DestroyStaticLayerCache();
+    staticLayersDirty = false;
+
+    if (!renderer || layers.empty() || tileTypes.empty() || mapWidth <= 0 || mapHeight <= 0) {
+        return;
+    }
+
+    chunkCols = (mapWidth + CHUNK_TILES - 1) / CHUNK_TILES;
+    chunkRows = (mapHeight + CHUNK_TILES - 1) / CHUNK_TILES;
+
+    // The bake copies straight from atlas pages, so make sure they're uploaded
+    textureManager->FlushAtlasPages();
+
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+
+    for (int cy = 0; cy < chunkRows; cy++) {
+        for (int cx = 0; cx < chunkCols; cx++) {
+            int tilesWide = std::min(CHUNK_TILES, mapWidth - cx * CHUNK_TILES);
+            int tilesHigh = std::min(CHUNK_TILES, mapHeight - cy * CHUNK_TILES);
+
+            SDL_Texture* chunk = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
+                                                   SDL_TEXTUREACCESS_TARGET,
+                                                   tilesWide * tileSize, tilesHigh * tileSize);
+            if (!chunk) {
+                // Render targets unsupported - fall back to per-tile drawing
+                std::cerr << "WARNING: Could not create static layer chunk: " << SDL_GetError() << std::endl;
+                SDL_SetRenderTarget(renderer, previousTarget);
+                DestroyStaticLayerCache();
+                staticLayersDirty = false;
+                return;
+            }
+
+            SDL_SetTextureBlendMode(chunk, SDL_BLENDMODE_BLEND);
+            SDL_SetRenderTarget(renderer, chunk);
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+            SDL_RenderClear(renderer);
+
+            // Bake every visible layer at native tile size; the per-frame
+            // copy scales the whole chunk at once
+            for (const auto& layer : layers) {
+                if (!layer.visible) continue;
+
+                for (int ty = 0; ty < tilesHigh; ty++) {
+                    for (int tx = 0; tx < tilesWide; tx++) {
+                        int mapX = cx * CHUNK_TILES + tx;
+                        int mapY = cy * CHUNK_TILES + ty;
+                        int index = mapY * mapWidth + mapX;
+                        if (index >= (int)layer.data.size()) continue;
+
+                        const TileType* tileType = GetTileTypeById(layer.data[index]);
+                        if (!tileType || !tileType->atlas.IsValid()) continue;
+
+                        SDL_Rect destRect = {tx * tileSize, ty * tileSize, tileSize, tileSize};
+                        SDL_RenderCopy(renderer, tileType->atlas.texture, &tileType->atlas.src, &destRect);
+                    }
+                }
+            }
+
+            staticChunks.push_back(chunk);
+        }
+    }
+
+    SDL_SetRenderTarget(renderer, previousTarget);
+    std::cout << "Baked static layers into " << staticChunks.size() << " chunks ("
+              << chunkCols << "x" << chunkRows << ")" << std::endl;
+}
+
 bool MapManager::LoadAtlas(const std::string& atlasFile) {
     std::cout << "Loading tile atlas: " << atlasFile << std::endl;
     
@@ -92,9 +225,9 @@ bool MapManager::LoadAtlas(const std::string& atlasFile) {
                 tile.avoidBonus = tileJson.value("avoid_bonus", 0);
                 tile.defenseBonus = tileJson.value("defense_bonus", 0);
                 
-                // Load texture
-                tile.texture = textureManager->LoadTexture(tile.texturePath);
-                if (!tile.texture) {
+                // Pack tile texture into the shared atlas
+                tile.atlas = textureManager->LoadIntoAtlas(tile.texturePath);
+                if (!tile.atlas.IsValid()) {
                     std::cerr << "WARNING: Failed to load tile texture: " << tile.texturePath << std::endl;
                 }
                 
@@ -103,6 +236,19 @@ bool MapManager::LoadAtlas(const std::string& atlasFile) {
             }
         }
         
+        // Build the dense tile ID -> TileType index used by the render
+        // and terrain lookups (tile IDs are small and near-contiguous)
+        int maxTileId = 0;
+        for (const auto& tile : tileTypes) {
+            maxTileId = std::max(maxTileId, tile.id);
+        }
+        tileTypeLookup.assign(maxTileId + 1, -1);
+        for (size_t i = 0; i < tileTypes.size(); i++) {
+            if (tileTypes[i].id >= 0) {
+                tileTypeLookup[tileTypes[i].id] = static_cast<int>(i);
+            }
+        }
+        
         std::cout << "Atlas loaded: " << tileTypes.size() << " tile types" << std::endl;
         return true;
         
@@ -112,17 +258,13 @@ bool MapManager::LoadAtlas(const std::string& atlasFile) {
     }
 }
 
-bool MapManager::LoadMap(const std::string& mapFile) {
-    std::cout << "Loading map: " << mapFile << std::endl;
-    
-    ClearMap();
-    
+void MapManager::ResetMapState() {
     // Reset cursor and camera to starting position
     cursorX = 0;
     cursorY = 0;
     cameraX = 0;
     cameraY = 0;
-    
+
     // Reset all UI states
     selectedUnitIndex = -1;
     showActionMenu = false;
@@ -133,11 +275,46 @@ bool MapManager::LoadMap(const std::string& mapFile) {
     showDropConfirmation = false;
     showUnitInfo = false;
     unitInfoIndex = -1;
-    moveRangeTiles.clear();
-    attackRangeTiles.clear();
+    moveCostGrid.clear();
+    attackRangeGrid.clear();
+    movePath.clear();
     originalInventory.clear();
     originalEquippedIndex = -1;
-    
+    turnNumber = 1;
+}
+
+bool MapManager::LoadMap(const std::string& mapFile) {
+    std::cout << "Loading map: " << mapFile << std::endl;
+
+    ClearMap();
+    ResetMapState();
+    mapFilePath = mapFile;
+
+    // Explicit binary map
+    if (mapFile.size() > 5 && mapFile.compare(mapFile.size() - 5, 5, ".lmap") == 0) {
+        return LoadMapBinary(mapFile);
+    }
+
+    // Prefer a compiled sibling of a JSON map when one exists
+    size_t dot = mapFile.rfind('.');
+    if (dot != std::string::npos) {
+        std::string binFile = mapFile.substr(0, dot) + ".lmap";
+        std::ifstream probe(binFile, std::ios::binary);
+        if (probe.is_open()) {
+            probe.close();
+            if (LoadMapBinary(binFile)) {
+                return true;
+            }
+            // Stale or corrupt binary: fall back to the JSON source
+            ClearMap();
+            ResetMapState();
+        }
+    }
+
+    return LoadMapJson(mapFile);
+}
+
+bool MapManager::LoadMapJson(const std::string& mapFile) {
     try {
         std::ifstream file(mapFile);
         if (!file.is_open()) {
@@ -199,90 +376,102 @@ bool MapManager::LoadMap(const std::string& mapFile) {
             try {
                 std::ifstream weaponsFile("data/weapons.json");
                 if (weaponsFile.is_open()) {
+                    json weaponsData;
                     weaponsFile >> weaponsData;
                     weaponsFile.close();
+                    BuildWeaponTable(weaponsData);
                 }
             } catch (const std::exception& e) {
                 std::cerr << "WARNING: Failed to load weapons.json: " << e.what() << std::endl;
             }
-            
+
             try {
                 std::ifstream classesFile("data/classes.json");
                 if (classesFile.is_open()) {
+                    json classesData;
                     classesFile >> classesData;
                     classesFile.close();
+                    BuildClassTable(classesData);
                 }
             } catch (const std::exception& e) {
                 std::cerr << "WARNING: Failed to load classes.json: " << e.what() << std::endl;
             }
             
             for (const auto& unitJson : mapData["units"]) {
-                MapUnit unit;
-                unit.type = unitJson.value("type", "");
-                unit.unitId = unitJson.value("unit_id", "");
-                unit.spritePath = unitJson.value("sprite", "");
-                unit.x = unitJson.value("x", 0);
-                unit.y = unitJson.value("y", 0);
-                
+                MapUnitHot hot;
+                MapUnitCold cold;
+                cold.type = unitJson.value("type", "");
+                cold.unitId = unitJson.value("unit_id", "");
+                cold.spritePath = unitJson.value("sprite", "");
+                hot.isPlayer = (cold.type == "player");
+                hot.x = unitJson.value("x", 0);
+                hot.y = unitJson.value("y", 0);
+
                 // Load unit data from units.json if unit_id is specified
                 // units.json is now organized as: { "player": { "alvis": {...} }, "enemy": {...} }
                 json unitData;
                 bool foundUnit = false;
-                if (!unit.unitId.empty() && unitsData.contains(unit.type)) {
-                    if (unitsData[unit.type].contains(unit.unitId)) {
-                        unitData = unitsData[unit.type][unit.unitId];
+                if (!cold.unitId.empty() && unitsData.contains(cold.type)) {
+                    if (unitsData[cold.type].contains(cold.unitId)) {
+                        unitData = unitsData[cold.type][cold.unitId];
                         foundUnit = true;
                     }
                 }
-                
+
                 if (foundUnit) {
-                    unit.name = unitData.value("name", "Unknown");
+                    cold.name = unitData.value("name", "Unknown");
                     std::string classId = unitData.value("class", "");
-                    unit.className = GetClassDisplayName(classId);
-                    unit.level = unitData.value("level", 1);
-                    
+                    cold.className = GetClassDisplayName(classId);
+                    hot.level = unitData.value("level", 1);
+
                     if (unitData.contains("stats")) {
                         const auto& stats = unitData["stats"];
-                        unit.maxHp = stats.value("hp", 20);
-                        unit.hp = unit.maxHp;
-                        unit.str = stats.value("str", 5);
-                        unit.mag = stats.value("mag", 5);
-                        unit.skl = stats.value("skl", 5);
-                        unit.spd = stats.value("spd", 5);
-                        unit.lck = stats.value("lck", 5);
-                        unit.def = stats.value("def", 5);
-                        unit.res = stats.value("res", 5);
-                        unit.con = stats.value("con", 5);
-                        unit.mov = stats.value("mov", 5);
+                        hot.maxHp = stats.value("hp", 20);
+                        hot.hp = hot.maxHp;
+                        hot.str = stats.value("str", 5);
+                        hot.mag = stats.value("mag", 5);
+                        hot.skl = stats.value("skl", 5);
+                        hot.spd = stats.value("spd", 5);
+                        hot.lck = stats.value("lck", 5);
+                        hot.def = stats.value("def", 5);
+                        hot.res = stats.value("res", 5);
+                        hot.con = stats.value("con", 5);
+                        hot.mov = stats.value("mov", 5);
                     }
-                    
+
                     // Load inventory
                     if (unitData.contains("current_inventory") && unitData["current_inventory"].is_array()) {
                         for (const auto& itemId : unitData["current_inventory"]) {
-                            unit.inventory.push_back(itemId.get<std::string>());
+                            cold.inventory.push_back(StringInterner::Intern(itemId.get<std::string>()));
                         }
                         // Equip first item by default
-                        if (!unit.inventory.empty()) {
-                            unit.equippedItemIndex = 0;
+                        if (!cold.inventory.empty()) {
+                            hot.equippedItemIndex = 0;
                         }
                     }
                 } else {
                     // Default values if no unit data found
-                    unit.name = "Unknown";
-                    unit.mov = 5;
+                    cold.name = "Unknown";
+                    hot.mov = 5;
                 }
-                
-                // Load unit texture
-                unit.texture = textureManager->LoadTexture(unit.spritePath);
-                if (!unit.texture) {
-                    std::cerr << "WARNING: Failed to load unit sprite: " << unit.spritePath << std::endl;
+
+                // Load unit sprite into the shared atlas and bind its frame table
+                hot.animHandle = LoadSpriteFrames(cold.spritePath);
+                if (hot.animHandle != SPRITE_ANIM_NONE) {
+                    hot.sprite = animTable[hot.animHandle].frames[0];
+                } else {
+                    std::cerr << "WARNING: Failed to load unit sprite: " << cold.spritePath << std::endl;
                 }
-                
-                units.push_back(unit);
-                std::cout << "  Loaded " << unit.type << " unit '" << unit.name << "' at (" << unit.x << ", " << unit.y << ")" << std::endl;
+
+                unitsHot.push_back(hot);
+                unitsCold.push_back(std::move(cold));
+                std::cout << "  Loaded " << unitsCold.back().type << " unit '" << unitsCold.back().name << "' at (" << hot.x << ", " << hot.y << ")" << std::endl;
             }
         }
         
+        RebuildOccupancyGrid();
+
+        staticLayersDirty = true;
         std::cout << "Map loaded: " << mapName << " (" << mapWidth << "x" << mapHeight << ")" << std::endl;
         return true;
         
@@ -292,6 +481,263 @@ bool MapManager::LoadMap(const std::string& mapFile) {
     }
 }
 
+bool MapManager::LoadMapBinary(const std::string& mapFile) {
+    std::ifstream file(mapFile, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "ERROR: Could not open map file: " << mapFile << std::endl;
+        return false;
+    }
+
+    if (ReadU32(file) != LMAP_MAGIC) {
+        std::cerr << "ERROR: Not a compiled map: " << mapFile << std::endl;
+        return false;
+    }
+    if (ReadU32(file) != LMAP_VERSION) {
+        std::cerr << "ERROR: Unsupported map version in " << mapFile << std::endl;
+        return false;
+    }
+
+    tileSize = ReadI32(file);
+    mapWidth = ReadI32(file);
+    mapHeight = ReadI32(file);
+
+    // String table: every ID and name in the file is an index into this
+    uint32_t stringCount = ReadU32(file);
+    std::vector<std::string> stringTable(stringCount);
+    for (uint32_t i = 0; i < stringCount; i++) {
+        uint32_t length = ReadU32(file);
+        stringTable[i].resize(length);
+        if (length > 0) {
+            file.read(&stringTable[i][0], length);
+        }
+    }
+
+    auto tableString = [&](uint32_t index) -> const std::string& {
+        static const std::string empty;
+        return (index < stringTable.size()) ? stringTable[index] : empty;
+    };
+
+    mapName = tableString(ReadU32(file));
+    mapMusic = tableString(ReadU32(file));
+    std::string atlasFile = tableString(ReadU32(file));
+
+    if (!file.good()) {
+        std::cerr << "ERROR: Truncated map file: " << mapFile << std::endl;
+        return false;
+    }
+
+    if (!atlasFile.empty() && !LoadAtlas(atlasFile)) {
+        std::cerr << "ERROR: Failed to load atlas for map" << std::endl;
+        return false;
+    }
+
+    // Layer data loads as one block read per layer
+    uint32_t layerCount = ReadU32(file);
+    for (uint32_t i = 0; i < layerCount; i++) {
+        MapLayer layer;
+        layer.name = tableString(ReadU32(file));
+        layer.visible = ReadU8(file) != 0;
+
+        uint32_t dataCount = ReadU32(file);
+        layer.data.resize(dataCount);
+        if (dataCount > 0) {
+            file.read(reinterpret_cast<char*>(layer.data.data()),
+                      (std::streamsize)dataCount * sizeof(int32_t));
+        }
+
+        layers.push_back(std::move(layer));
+        std::cout << "  Loaded layer: " << layers.back().name << " (" << layers.back().data.size() << " tiles)" << std::endl;
+    }
+
+    // Units are stored fully resolved, so units.json isn't consulted here;
+    // weapons/classes are still needed for combat and inventory display
+    try {
+        std::ifstream weaponsFile("data/weapons.json");
+        if (weaponsFile.is_open()) {
+            json weaponsData;
+            weaponsFile >> weaponsData;
+            BuildWeaponTable(weaponsData);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "WARNING: Failed to load weapons.json: " << e.what() << std::endl;
+    }
+
+    try {
+        std::ifstream classesFile("data/classes.json");
+        if (classesFile.is_open()) {
+            json classesData;
+            classesFile >> classesData;
+            BuildClassTable(classesData);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "WARNING: Failed to load classes.json: " << e.what() << std::endl;
+    }
+
+    uint32_t unitCount = ReadU32(file);
+    for (uint32_t i = 0; i < unitCount; i++) {
+        MapUnitHot hot;
+        MapUnitCold cold;
+        cold.type = tableString(ReadU32(file));
+        cold.unitId = tableString(ReadU32(file));
+        cold.name = tableString(ReadU32(file));
+        cold.className = tableString(ReadU32(file));
+        cold.spritePath = tableString(ReadU32(file));
+        hot.isPlayer = (cold.type == "player");
+        hot.level = ReadI32(file);
+        hot.x = ReadI32(file);
+        hot.y = ReadI32(file);
+        hot.hp = ReadI32(file);
+        hot.maxHp = ReadI32(file);
+        hot.str = ReadI32(file);
+        hot.mag = ReadI32(file);
+        hot.skl = ReadI32(file);
+        hot.spd = ReadI32(file);
+        hot.lck = ReadI32(file);
+        hot.def = ReadI32(file);
+        hot.res = ReadI32(file);
+        hot.con = ReadI32(file);
+        hot.mov = ReadI32(file);
+        hot.equippedItemIndex = ReadI32(file);
+
+        uint32_t inventoryCount = ReadU32(file);
+        cold.inventory.reserve(inventoryCount);
+        for (uint32_t j = 0; j < inventoryCount; j++) {
+            cold.inventory.push_back(StringInterner::Intern(tableString(ReadU32(file))));
+        }
+
+        hot.animHandle = LoadSpriteFrames(cold.spritePath);
+        if (hot.animHandle != SPRITE_ANIM_NONE) {
+            hot.sprite = animTable[hot.animHandle].frames[0];
+        } else {
+            std::cerr << "WARNING: Failed to load unit sprite: " << cold.spritePath << std::endl;
+        }
+
+        unitsHot.push_back(hot);
+        unitsCold.push_back(std::move(cold));
+    }
+
+    if (!file.good() && !file.eof()) {
+        std::cerr << "ERROR: Truncated map file: " << mapFile << std::endl;
+        return false;
+    }
+
+    RebuildOccupancyGrid();
+
+    staticLayersDirty = true;
+    std::cout << "Map loaded (binary): " << mapName << " (" << mapWidth << "x" << mapHeight << ")" << std::endl;
+    return true;
+}
+
+bool MapManager::CompileMapBinary(const std::string& jsonMapFile, const std::string& outFile) {
+    // Load the JSON source through the normal path so the binary captures
+    // fully resolved units (stats and inventory merged from units.json)
+    ClearMap();
+    ResetMapState();
+    if (!LoadMapJson(jsonMapFile)) {
+        return false;
+    }
+
+    std::ofstream out(outFile, std::ios::binary);
+    if (!out.is_open()) {
+        std::cerr << "ERROR: Could not write compiled map: " << outFile << std::endl;
+        return false;
+    }
+
+    // Intern every string once and reference it by index
+    std::vector<std::string> stringTable;
+    std::unordered_map<std::string, uint32_t> stringIndex;
+    auto intern = [&](const std::string& value) -> uint32_t {
+        auto it = stringIndex.find(value);
+        if (it != stringIndex.end()) {
+            return it->second;
+        }
+        uint32_t index = (uint32_t)stringTable.size();
+        stringTable.push_back(value);
+        stringIndex[value] = index;
+        return index;
+    };
+
+    uint32_t nameIdx = intern(mapName);
+    uint32_t musicIdx = intern(mapMusic);
+    uint32_t atlasIdx = intern(atlasPath);
+    for (const auto& layer : layers) {
+        intern(layer.name);
+    }
+    for (const auto& cold : unitsCold) {
+        intern(cold.type);
+        intern(cold.unitId);
+        intern(cold.name);
+        intern(cold.className);
+        intern(cold.spritePath);
+        for (const auto& itemId : cold.inventory) {
+            intern(StringInterner::Lookup(itemId));
+        }
+    }
+
+    WriteU32(out, LMAP_MAGIC);
+    WriteU32(out, LMAP_VERSION);
+    WriteI32(out, tileSize);
+    WriteI32(out, mapWidth);
+    WriteI32(out, mapHeight);
+
+    WriteU32(out, (uint32_t)stringTable.size());
+    for (const auto& value : stringTable) {
+        WriteU32(out, (uint32_t)value.size());
+        out.write(value.data(), (std::streamsize)value.size());
+    }
+
+    WriteU32(out, nameIdx);
+    WriteU32(out, musicIdx);
+    WriteU32(out, atlasIdx);
+
+    WriteU32(out, (uint32_t)layers.size());
+    for (const auto& layer : layers) {
+        WriteU32(out, stringIndex[layer.name]);
+        WriteU8(out, layer.visible ? 1 : 0);
+        WriteU32(out, (uint32_t)layer.data.size());
+        out.write(reinterpret_cast<const char*>(layer.data.data()),
+                  (std::streamsize)layer.data.size() * sizeof(int32_t));
+    }
+
+    WriteU32(out, (uint32_t)unitsHot.size());
+    for (size_t i = 0; i < unitsHot.size(); i++) {
+        const MapUnitHot& hot = unitsHot[i];
+        const MapUnitCold& cold = unitsCold[i];
+        WriteU32(out, stringIndex[cold.type]);
+        WriteU32(out, stringIndex[cold.unitId]);
+        WriteU32(out, stringIndex[cold.name]);
+        WriteU32(out, stringIndex[cold.className]);
+        WriteU32(out, stringIndex[cold.spritePath]);
+        WriteI32(out, hot.level);
+        WriteI32(out, hot.x);
+        WriteI32(out, hot.y);
+        WriteI32(out, hot.hp);
+        WriteI32(out, hot.maxHp);
+        WriteI32(out, hot.str);
+        WriteI32(out, hot.mag);
+        WriteI32(out, hot.skl);
+        WriteI32(out, hot.spd);
+        WriteI32(out, hot.lck);
+        WriteI32(out, hot.def);
+        WriteI32(out, hot.res);
+        WriteI32(out, hot.con);
+        WriteI32(out, hot.mov);
+        WriteI32(out, hot.equippedItemIndex);
+        WriteU32(out, (uint32_t)cold.inventory.size());
+        for (const auto& itemId : cold.inventory) {
+            WriteU32(out, stringIndex[StringInterner::Lookup(itemId)]);
+        }
+    }
+
+    if (!out.good()) {
+        std::cerr << "ERROR: Failed writing compiled map: " << outFile << std::endl;
+        return false;
+    }
+
+    std::cout << "Compiled map: " << jsonMapFile << " -> " << outFile << std::endl;
+    return true;
+}
+
 void MapManager::Render() {
     if (layers.empty() || tileTypes.empty()) {
         return;
@@ -299,87 +745,144 @@ void MapManager::Render() {
     
     int scaledTileSize = static_cast<int>(tileSize * scale);
     
-    // Render each layer
-    for (const auto& layer : layers) {
-        if (!layer.visible) continue;
-        
-        // Render tiles
-        for (int y = 0; y < mapHeight; y++) {
-            for (int x = 0; x < mapWidth; x++) {
-                int index = y * mapWidth + x;
-                if (index >= layer.data.size()) continue;
-                
-                int tileId = layer.data[index];
-                
-                // Find tile type
-                SDL_Texture* texture = nullptr;
-                for (const auto& tileType : tileTypes) {
-                    if (tileType.id == tileId) {
-                        texture = tileType.texture;
-                        break;
-                    }
+    if (staticLayersDirty) {
+        RebuildStaticLayerCache();
+    }
+
+    if (!staticChunks.empty()) {
+        // Static layers are pre-baked: copy only the visible chunks
+        int scaledChunkSize = CHUNK_TILES * scaledTileSize;
+
+        for (int cy = 0; cy < chunkRows; cy++) {
+            for (int cx = 0; cx < chunkCols; cx++) {
+                int screenX = (cx * scaledChunkSize) - cameraX;
+                int screenY = (cy * scaledChunkSize) - cameraY;
+
+                int tilesWide = std::min(CHUNK_TILES, mapWidth - cx * CHUNK_TILES);
+                int tilesHigh = std::min(CHUNK_TILES, mapHeight - cy * CHUNK_TILES);
+                int chunkW = tilesWide * scaledTileSize;
+                int chunkH = tilesHigh * scaledTileSize;
+
+                if (screenX + chunkW < 0 || screenX >= 1920 ||
+                    screenY + chunkH < 0 || screenY >= 1080) {
+                    continue;
                 }
-                
-                if (texture) {
-                    // Calculate screen position with scaling
-                    int screenX = (x * scaledTileSize) - cameraX;
-                    int screenY = (y * scaledTileSize) - cameraY;
-                    
-                    // Only render if on screen (1920x1080)
-                    if (screenX + scaledTileSize >= 0 && screenX < 1920 &&
-                        screenY + scaledTileSize >= 0 && screenY < 1080) {
-                        textureManager->RenderTexture(texture, screenX, screenY, scaledTileSize, scaledTileSize);
+
+                textureManager->RenderTexture(staticChunks[cy * chunkCols + cx],
+                                              screenX, screenY, chunkW, chunkH);
+            }
+        }
+    } else {
+        // Fallback path when render targets are unavailable
+        int startX, startY, endX, endY;
+        GetVisibleTileWindow(scaledTileSize, startX, startY, endX, endY);
+
+        for (const auto& layer : layers) {
+            if (!layer.visible) continue;
+
+            for (int y = startY; y <= endY; y++) {
+                for (int x = startX; x <= endX; x++) {
+                    int index = y * mapWidth + x;
+                    if (index >= (int)layer.data.size()) continue;
+
+                    const TileType* tileType = GetTileTypeById(layer.data[index]);
+                    if (tileType && tileType->atlas.IsValid()) {
+                        int screenX = (x * scaledTileSize) - cameraX;
+                        int screenY = (y * scaledTileSize) - cameraY;
+                        textureManager->RenderAtlasRegion(tileType->atlas, screenX, screenY, scaledTileSize, scaledTileSize);
                     }
                 }
             }
         }
     }
     
+    // Render the danger zone under the selection markers. UpdateDangerZone
+    // only touches units flagged dirty, so this is a no-op most frames.
+    if (showDangerZone && !unitsHot.empty()) {
+        UpdateDangerZone();
+
+        int startX, startY, endX, endY;
+        GetVisibleTileWindow(scaledTileSize, startX, startY, endX, endY);
+
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(renderer, 220, 50, 50, 70);
+
+        for (int y = startY; y <= endY; y++) {
+            for (int x = startX; x <= endX; x++) {
+                if (!dangerGrid[y * mapWidth + x]) continue;
+
+                SDL_Rect tile = {(x * scaledTileSize) - cameraX,
+                                 (y * scaledTileSize) - cameraY,
+                                 scaledTileSize, scaledTileSize};
+                SDL_RenderFillRect(renderer, &tile);
+            }
+        }
+    }
+
     // Render movement range tiles
-    if (selectedUnitIndex >= 0 && moveRangeTexture && !showActionMenu) {
-        for (const auto& tile : moveRangeTiles) {
-            int screenX = (tile.first * scaledTileSize) - cameraX;
-            int screenY = (tile.second * scaledTileSize) - cameraY;
-            
-            if (screenX + scaledTileSize >= 0 && screenX < 1920 &&
-                screenY + scaledTileSize >= 0 && screenY < 1080) {
-                textureManager->RenderTexture(moveRangeTexture, screenX, screenY, scaledTileSize, scaledTileSize);
+    if (selectedUnitIndex >= 0 && moveRangeMarker.IsValid() && !showActionMenu && !moveCostGrid.empty()) {
+        int startX, startY, endX, endY;
+        GetVisibleTileWindow(scaledTileSize, startX, startY, endX, endY);
+
+        for (int y = startY; y <= endY; y++) {
+            for (int x = startX; x <= endX; x++) {
+                if (moveCostGrid[y * mapWidth + x] < 0) continue;
+
+                int screenX = (x * scaledTileSize) - cameraX;
+                int screenY = (y * scaledTileSize) - cameraY;
+                textureManager->RenderAtlasRegion(moveRangeMarker, screenX, screenY, scaledTileSize, scaledTileSize);
             }
         }
     }
     
     // Render attack range tiles
-    if (selectedUnitIndex >= 0 && attackRangeTexture && !showActionMenu) {
-        for (const auto& tile : attackRangeTiles) {
-            int screenX = (tile.first * scaledTileSize) - cameraX;
-            int screenY = (tile.second * scaledTileSize) - cameraY;
-            
-            if (screenX + scaledTileSize >= 0 && screenX < 1920 &&
-                screenY + scaledTileSize >= 0 && screenY < 1080) {
-                textureManager->RenderTexture(attackRangeTexture, screenX, screenY, scaledTileSize, scaledTileSize);
+    if (selectedUnitIndex >= 0 && attackRangeMarker.IsValid() && !showActionMenu && !attackRangeGrid.empty()) {
+        int startX, startY, endX, endY;
+        GetVisibleTileWindow(scaledTileSize, startX, startY, endX, endY);
+
+        for (int y = startY; y <= endY; y++) {
+            for (int x = startX; x <= endX; x++) {
+                if (!attackRangeGrid[y * mapWidth + x]) continue;
+
+                int screenX = (x * scaledTileSize) - cameraX;
+                int screenY = (y * scaledTileSize) - cameraY;
+                textureManager->RenderAtlasRegion(attackRangeMarker, screenX, screenY, scaledTileSize, scaledTileSize);
             }
         }
     }
     
-    // Render units on top of tiles
-    for (const auto& unit : units) {
-        if (unit.texture) {
+    // Render the movement path preview between the ranges and the units
+    if (selectedUnitIndex >= 0 && !showActionMenu && movePath.size() >= 2) {
+        RenderMovePath(scaledTileSize);
+    }
+
+    // Render units on top of tiles (hot data only: position + atlas
+    // handle); the current animation frame is just a different src rect
+    // into the same atlas page, so animated units batch exactly like
+    // static ones
+    for (const auto& unit : unitsHot) {
+        const TextureManager::AtlasRegion* frame = &unit.sprite;
+        if (unit.animHandle != SPRITE_ANIM_NONE) {
+            const SpriteFrames& anim = animTable[unit.animHandle];
+            frame = &anim.frames[unit.animFrame % anim.frames.size()];
+        }
+        if (frame->IsValid()) {
             int screenX = (unit.x * scaledTileSize) - cameraX;
             int screenY = (unit.y * scaledTileSize) - cameraY;
-            
+
             // Only render if on screen
             if (screenX + scaledTileSize >= 0 && screenX < 1920 &&
                 screenY + scaledTileSize >= 0 && screenY < 1080) {
-                textureManager->RenderTexture(unit.texture, screenX, screenY, scaledTileSize, scaledTileSize);
+                textureManager->RenderAtlasRegion(*frame, screenX, screenY, scaledTileSize, scaledTileSize);
             }
         }
     }
     
     // Render cursor on top of everything
-    if (showCursor && cursorTexture) {
+    if (showCursor && cursorMarker.IsValid()) {
         int screenX = (cursorX * scaledTileSize) - cameraX;
         int screenY = (cursorY * scaledTileSize) - cameraY;
-        textureManager->RenderTexture(cursorTexture, screenX, screenY, scaledTileSize, scaledTileSize);
+        textureManager->RenderAtlasRegion(cursorMarker, screenX, screenY, scaledTileSize, scaledTileSize);
     }
     
     // Render action menu if active
@@ -411,33 +914,15 @@ void MapManager::Render() {
         // Render text
         SDL_Color textColor = {255, 255, 255, 255};
         
-        SDL_Surface* inventorySurface = TTF_RenderText_Blended(font, "Items", textColor);
-        if (inventorySurface) {
-            SDL_Texture* inventoryTexture = SDL_CreateTextureFromSurface(renderer, inventorySurface);
-            if (inventoryTexture) {
-                SDL_Rect textRect = {inventoryBox.x + 10, inventoryBox.y + 8, inventorySurface->w, inventorySurface->h};
-                SDL_RenderCopy(renderer, inventoryTexture, nullptr, &textRect);
-                SDL_DestroyTexture(inventoryTexture);
-            }
-            SDL_FreeSurface(inventorySurface);
-        }
-        
-        SDL_Surface* waitSurface = TTF_RenderText_Blended(font, "Wait", textColor);
-        if (waitSurface) {
-            SDL_Texture* waitTexture = SDL_CreateTextureFromSurface(renderer, waitSurface);
-            if (waitTexture) {
-                SDL_Rect textRect = {waitBox.x + 10, waitBox.y + 8, waitSurface->w, waitSurface->h};
-                SDL_RenderCopy(renderer, waitTexture, nullptr, &textRect);
-                SDL_DestroyTexture(waitTexture);
-            }
-            SDL_FreeSurface(waitSurface);
-        }
+        DrawMenuText("Items", inventoryBox.x + 10, inventoryBox.y + 8, textColor);
+        DrawMenuText("Wait", waitBox.x + 10, waitBox.y + 8, textColor);
     }
     
     // Render inventory menu if active
     if (showInventoryMenu && font && inventoryUnitIndex >= 0) {
-        const auto& unit = units[inventoryUnitIndex];
-        
+        const MapUnitHot& unitHot = unitsHot[inventoryUnitIndex];
+        const MapUnitCold& unit = unitsCold[inventoryUnitIndex];
+
         // Draw inventory box
         int menuHeight = 150 + (unit.inventory.size() * 40);
         SDL_Rect inventoryMenuBox = {1920 - 450, 100, 400, menuHeight};
@@ -450,16 +935,7 @@ void MapManager::Render() {
         SDL_Color equippedColor = {100, 255, 100, 255};
         
         // Draw title
-        SDL_Surface* titleSurface = TTF_RenderText_Blended(font, ("Inventory - " + unit.name).c_str(), textColor);
-        if (titleSurface) {
-            SDL_Texture* titleTexture = SDL_CreateTextureFromSurface(renderer, titleSurface);
-            if (titleTexture) {
-                SDL_Rect titleRect = {inventoryMenuBox.x + 10, inventoryMenuBox.y + 10, titleSurface->w, titleSurface->h};
-                SDL_RenderCopy(renderer, titleTexture, nullptr, &titleRect);
-                SDL_DestroyTexture(titleTexture);
-            }
-            SDL_FreeSurface(titleSurface);
-        }
+        DrawMenuText("Inventory - " + unit.name, inventoryMenuBox.x + 10, inventoryMenuBox.y + 10, textColor);
         
         // Draw inventory items
         for (size_t i = 0; i < unit.inventory.size(); i++) {
@@ -478,22 +954,13 @@ void MapManager::Render() {
             bool canWield = CanUnitWieldWeapon(unit, weaponData);
             
             // Draw item name with proper capitalization
-            bool isEquipped = ((int)i == unit.equippedItemIndex);
+            bool isEquipped = ((int)i == unitHot.equippedItemIndex);
             std::string itemText = weaponData.name + (isEquipped ? " (E)" : "");
             
             // Use gray color if unit can't wield this weapon
             SDL_Color itemColor = canWield ? (isEquipped ? equippedColor : textColor) : SDL_Color{128, 128, 128, 255};
             
-            SDL_Surface* itemSurface = TTF_RenderText_Blended(font, itemText.c_str(), itemColor);
-            if (itemSurface) {
-                SDL_Texture* itemTexture = SDL_CreateTextureFromSurface(renderer, itemSurface);
-                if (itemTexture) {
-                    SDL_Rect textRect = {itemBox.x + 10, itemBox.y + 5, itemSurface->w, itemSurface->h};
-                    SDL_RenderCopy(renderer, itemTexture, nullptr, &textRect);
-                    SDL_DestroyTexture(itemTexture);
-                }
-                SDL_FreeSurface(itemSurface);
-            }
+            DrawMenuText(itemText, itemBox.x + 10, itemBox.y + 5, itemColor);
         }
         
         // Draw "Drop" option
@@ -507,16 +974,7 @@ void MapManager::Render() {
         SDL_SetRenderDrawColor(renderer, 180, 180, 200, 255);
         SDL_RenderDrawRect(renderer, &dropBox);
         
-        SDL_Surface* dropSurface = TTF_RenderText_Blended(font, "Drop Item", textColor);
-        if (dropSurface) {
-            SDL_Texture* dropTexture = SDL_CreateTextureFromSurface(renderer, dropSurface);
-            if (dropTexture) {
-                SDL_Rect textRect = {dropBox.x + 10, dropBox.y + 5, dropSurface->w, dropSurface->h};
-                SDL_RenderCopy(renderer, dropTexture, nullptr, &textRect);
-                SDL_DestroyTexture(dropTexture);
-            }
-            SDL_FreeSurface(dropSurface);
-        }
+        DrawMenuText("Drop Item", dropBox.x + 10, dropBox.y + 5, textColor);
         
         // Draw weapon info panel for selected item (if not on "Drop")
         if (selectedInventoryIndex < (int)unit.inventory.size()) {
@@ -535,16 +993,7 @@ void MapManager::Render() {
             SDL_Color whiteColor = {255, 255, 255, 255};
             
             auto renderInfoLine = [&](const std::string& text, const SDL_Color& color) {
-                SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), color);
-                if (surface) {
-                    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-                    if (texture) {
-                        SDL_Rect rect = {weaponInfoBox.x + 15, yPos, surface->w, surface->h};
-                        SDL_RenderCopy(renderer, texture, nullptr, &rect);
-                        SDL_DestroyTexture(texture);
-                    }
-                    SDL_FreeSurface(surface);
-                }
+                DrawMenuText(text, weaponInfoBox.x + 15, yPos, color);
                 yPos += lineHeight;
             };
             
@@ -585,8 +1034,8 @@ void MapManager::Render() {
         }
         
         // Draw drop confirmation dialog if active
-        if (showDropConfirmation && unit.equippedItemIndex >= 0 && unit.equippedItemIndex < (int)unit.inventory.size()) {
-            WeaponData weaponData = GetWeaponData(unit.inventory[unit.equippedItemIndex]);
+        if (showDropConfirmation && unitHot.equippedItemIndex >= 0 && unitHot.equippedItemIndex < (int)unit.inventory.size()) {
+            WeaponData weaponData = GetWeaponData(unit.inventory[unitHot.equippedItemIndex]);
             
             // Draw confirmation box in center
             SDL_Rect confirmBox = {760, 400, 400, 200};
@@ -597,17 +1046,13 @@ void MapManager::Render() {
             
             int yPos = confirmBox.y + 30;
             auto renderConfirmLine = [&](const std::string& text) {
-                SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), textColor);
-                if (surface) {
-                    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-                    if (texture) {
-                        // Center the text
-                        int textX = confirmBox.x + (confirmBox.w - surface->w) / 2;
-                        SDL_Rect rect = {textX, yPos, surface->w, surface->h};
-                        SDL_RenderCopy(renderer, texture, nullptr, &rect);
-                        SDL_DestroyTexture(texture);
-                    }
-                    SDL_FreeSurface(surface);
+                int textWidth, textHeight;
+                SDL_Texture* texture = textCache->GetTexture(text, font, textColor, textWidth, textHeight);
+                if (texture) {
+                    // Center the text
+                    int textX = confirmBox.x + (confirmBox.w - textWidth) / 2;
+                    SDL_Rect rect = {textX, yPos, textWidth, textHeight};
+                    SDL_RenderCopy(renderer, texture, nullptr, &rect);
                 }
                 yPos += 40;
             };
@@ -621,7 +1066,8 @@ void MapManager::Render() {
     
     // Render unit info panel if active
     if (showUnitInfo && font && unitInfoIndex >= 0) {
-        const auto& unit = units[unitInfoIndex];
+        const MapUnitHot& unit = unitsHot[unitInfoIndex];
+        const MapUnitCold& unitCold = unitsCold[unitInfoIndex];
         
         // Draw info panel
         SDL_Rect infoBox = {50, 100, 400, 500};
@@ -636,22 +1082,13 @@ void MapManager::Render() {
         
         // Helper lambda to render text line
         auto renderLine = [&](const std::string& text) {
-            SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), textColor);
-            if (surface) {
-                SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-                if (texture) {
-                    SDL_Rect rect = {infoBox.x + 15, yPos, surface->w, surface->h};
-                    SDL_RenderCopy(renderer, texture, nullptr, &rect);
-                    SDL_DestroyTexture(texture);
-                }
-                SDL_FreeSurface(surface);
-            }
+            DrawMenuText(text, infoBox.x + 15, yPos, textColor);
             yPos += lineHeight;
         };
         
         // Render unit info
-        renderLine(unit.name + " - Lv " + std::to_string(unit.level));
-        renderLine("Class: " + unit.className);
+        renderLine(unitCold.name + " - Lv " + std::to_string(unit.level));
+        renderLine("Class: " + unitCold.className);
         renderLine("HP: " + std::to_string(unit.hp) + "/" + std::to_string(unit.maxHp));
         renderLine("Str: " + std::to_string(unit.str) + "  Mag: " + std::to_string(unit.mag));
         renderLine("Skl: " + std::to_string(unit.skl) + "  Spd: " + std::to_string(unit.spd));
@@ -659,11 +1096,11 @@ void MapManager::Render() {
         renderLine("Res: " + std::to_string(unit.res) + "  Con: " + std::to_string(unit.con));
         renderLine("Mov: " + std::to_string(unit.mov));
         
-        if (!unit.inventory.empty()) {
+        if (!unitCold.inventory.empty()) {
             yPos += 10;
             renderLine("Inventory:");
-            for (int i = 0; i < (int)unit.inventory.size(); i++) {
-                WeaponData weaponData = GetWeaponData(unit.inventory[i]);
+            for (int i = 0; i < (int)unitCold.inventory.size(); i++) {
+                WeaponData weaponData = GetWeaponData(unitCold.inventory[i]);
                 bool isEquipped = (i == unit.equippedItemIndex);
                 std::string itemText = "  " + weaponData.name + (isEquipped ? " *" : "");
                 renderLine(itemText);
@@ -709,13 +1146,14 @@ void MapManager::MoveCursor(int dx, int dy) {
     if (cursorX >= mapWidth) cursorX = mapWidth - 1;
     if (cursorY >= mapHeight) cursorY = mapHeight - 1;
     
-    // Play cursor sound if position actually changed
-    if ((cursorX != oldX || cursorY != oldY) && cursorSound && configManager) {
+    // Play cursor sound if position actually changed (pooled chunk, no
+    // loading or allocation however fast the cursor moves)
+    if ((cursorX != oldX || cursorY != oldY) && audioManager && configManager) {
         // Only play if SFX volume is not 0
         int masterVol = configManager->GetMasterVolume();
         int sfxVol = configManager->GetSFXVolume();
         if (masterVol > 0 && sfxVol > 0) {
-            Mix_PlayChannel(-1, cursorSound, 0);
+            audioManager->PlaySFX("cursor_move");
         }
     }
     
@@ -739,6 +1177,12 @@ void MapManager::MoveCursor(int dx, int dy) {
     } else if (cursorScreenY > 1080 - scrollMargin - scaledTileSize) {
         MoveCamera(0, cursorScreenY - (1080 - scrollMargin - scaledTileSize));
     }
+
+    // Keep the path preview in sync while a unit is picking a destination
+    if (selectedUnitIndex >= 0 && !showActionMenu &&
+        (cursorX != oldX || cursorY != oldY)) {
+        UpdateMovePath();
+    }
 }
 
 void MapManager::SetCursorPosition(int x, int y) {
@@ -752,52 +1196,125 @@ void MapManager::SetCursorPosition(int x, int y) {
     if (cursorY >= mapHeight) cursorY = mapHeight - 1;
 }
 
-int MapManager::GetUnitAtPosition(int x, int y) const {
-    for (size_t i = 0; i < units.size(); i++) {
-        if (units[i].x == x && units[i].y == y) {
-            return static_cast<int>(i);
-        }
+const TileType* MapManager::GetTileTypeById(int tileId) const {
+    if (tileId < 0 || tileId >= (int)tileTypeLookup.size() || tileTypeLookup[tileId] < 0) {
+        return nullptr;
     }
-    return -1;
+    return &tileTypes[tileTypeLookup[tileId]];
 }
 
-void MapManager::SelectUnit() {
-    // Check if there's a player unit at cursor position
-    int unitIndex = GetUnitAtPosition(cursorX, cursorY);
-    if (unitIndex >= 0 && units[unitIndex].type == "player" && !units[unitIndex].hasMoved) {
-        selectedUnitIndex = unitIndex;
-        CalculateMovementRange();
-        CalculateAttackRange();
-        std::cout << "Selected unit at (" << cursorX << ", " << cursorY << ")" << std::endl;
-    }
+void MapManager::GetVisibleTileWindow(int scaledTileSize, int& startX, int& startY, int& endX, int& endY) const {
+    // Tile range covering the 1920x1080 screen at the current camera,
+    // clamped to the map - loops over this window instead of the full map
+    startX = std::max(0, cameraX / scaledTileSize);
+    startY = std::max(0, cameraY / scaledTileSize);
+    endX = std::min(mapWidth - 1, (cameraX + 1920) / scaledTileSize);
+    endY = std::min(mapHeight - 1, (cameraY + 1080) / scaledTileSize);
 }
 
-void MapManager::CancelSelection() {
-    selectedUnitIndex = -1;
-    moveRangeTiles.clear();
-    attackRangeTiles.clear();
-    showActionMenu = false;
-    selectedActionIndex = 0;
-    std::cout << "Selection cancelled" << std::endl;
+void MapManager::DrawMenuText(const std::string& text, int x, int y, SDL_Color color) {
+    int textWidth, textHeight;
+    SDL_Texture* texture = textCache->GetTexture(text, font, color, textWidth, textHeight);
+    if (texture) {
+        SDL_Rect textRect = {x, y, textWidth, textHeight};
+        SDL_RenderCopy(renderer, texture, nullptr, &textRect);
+    }
 }
 
-void MapManager::ConfirmMove() {
-    if (selectedUnitIndex < 0 || !IsInMoveRange(cursorX, cursorY)) {
-        return;
+const TileType* MapManager::GetTerrainAt(int x, int y) const {
+    if (x < 0 || y < 0 || x >= mapWidth || y >= mapHeight) {
+        return nullptr;
+    }
+
+    // Topmost visible layer with a known tile type defines the terrain
+    int index = y * mapWidth + x;
+    for (auto it = layers.rbegin(); it != layers.rend(); ++it) {
+        if (!it->visible || index >= (int)it->data.size()) continue;
+
+        const TileType* tileType = GetTileTypeById(it->data[index]);
+        if (tileType) {
+            return tileType;
+        }
+    }
+    return nullptr;
+}
+
+void MapManager::RebuildOccupancyGrid() {
+    occupancyGrid.assign(mapWidth * mapHeight, -1);
+    for (size_t i = 0; i < unitsHot.size(); i++) {
+        const MapUnitHot& unit = unitsHot[i];
+        if (unit.x >= 0 && unit.y >= 0 && unit.x < mapWidth && unit.y < mapHeight) {
+            occupancyGrid[unit.y * mapWidth + unit.x] = static_cast<int>(i);
+        }
+    }
+
+    // Unit list or map dimensions changed, so the per-unit threat grids
+    // no longer line up - start the danger zone over from scratch
+    ResetDangerZone();
+}
+
+void MapManager::MoveUnitTo(int unitIndex, int x, int y) {
+    MapUnitHot& unit = unitsHot[unitIndex];
+    int oldIndex = unit.y * mapWidth + unit.x;
+    if (oldIndex >= 0 && oldIndex < (int)occupancyGrid.size() &&
+        occupancyGrid[oldIndex] == unitIndex) {
+        occupancyGrid[oldIndex] = -1;
+    }
+    unit.x = x;
+    unit.y = y;
+    int newIndex = y * mapWidth + x;
+    if (newIndex >= 0 && newIndex < (int)occupancyGrid.size()) {
+        occupancyGrid[newIndex] = unitIndex;
+    }
+    MarkThreatDirty(unitIndex);
+}
+
+int MapManager::GetUnitAtPosition(int x, int y) const {
+    if (x < 0 || y < 0 || x >= mapWidth || y >= mapHeight) {
+        return -1;
+    }
+    return occupancyGrid[y * mapWidth + x];
+}
+
+void MapManager::SelectUnit() {
+    // Check if there's a player unit at cursor position
+    int unitIndex = GetUnitAtPosition(cursorX, cursorY);
+    if (unitIndex >= 0 && unitsHot[unitIndex].isPlayer && !unitsHot[unitIndex].hasMoved) {
+        selectedUnitIndex = unitIndex;
+        CalculateMovementRange();
+        CalculateAttackRange();
+        UpdateMovePath();
+        std::cout << "Selected unit at (" << cursorX << ", " << cursorY << ")" << std::endl;
+    }
+}
+
+void MapManager::CancelSelection() {
+    selectedUnitIndex = -1;
+    std::fill(moveCostGrid.begin(), moveCostGrid.end(), -1);
+    std::fill(attackRangeGrid.begin(), attackRangeGrid.end(), (uint8_t)0);
+    movePath.clear();
+    showActionMenu = false;
+    selectedActionIndex = 0;
+    std::cout << "Selection cancelled" << std::endl;
+}
+
+void MapManager::ConfirmMove() {
+    if (selectedUnitIndex < 0 || !IsInMoveRange(cursorX, cursorY)) {
+        return;
     }
     
-    // Store original position for potential cancellation
-    originalUnitX = units[selectedUnitIndex].x;
-    originalUnitY = units[selectedUnitIndex].y;
-    
-    // Move the unit
-    units[selectedUnitIndex].x = cursorX;
-    units[selectedUnitIndex].y = cursorY;
-    
-    // Clear movement ranges
-    moveRangeTiles.clear();
-    attackRangeTiles.clear();
+    // Store original position for potential cancellation
+    originalUnitX = unitsHot[selectedUnitIndex].x;
+    originalUnitY = unitsHot[selectedUnitIndex].y;
+
+    // Move the unit (keeps the occupancy grid in sync)
+    MoveUnitTo(selectedUnitIndex, cursorX, cursorY);
     
+    // Clear movement ranges and path preview
+    std::fill(moveCostGrid.begin(), moveCostGrid.end(), -1);
+    std::fill(attackRangeGrid.begin(), attackRangeGrid.end(), (uint8_t)0);
+    movePath.clear();
+
     // Show action menu
     showActionMenu = true;
     selectedActionIndex = 0;
@@ -806,93 +1323,238 @@ void MapManager::ConfirmMove() {
 }
 
 void MapManager::CalculateMovementRange() {
-    moveRangeTiles.clear();
-    
-    if (selectedUnitIndex < 0) return;
-    
-    const MapUnit& unit = units[selectedUnitIndex];
+    // Reuse the cost grid between selections instead of rebuilding a tile list
+    moveCostGrid.assign(mapWidth * mapHeight, -1);
+
+    if (selectedUnitIndex < 0 || mapWidth <= 0 || mapHeight <= 0) return;
+
+    const MapUnitHot& unit = unitsHot[selectedUnitIndex];
     int range = unit.mov;
-    
-    // Simple flood fill for movement range (Manhattan distance)
-    // Include current position (distance == 0) to allow staying in place
-    for (int y = 0; y < mapHeight; y++) {
-        for (int x = 0; x < mapWidth; x++) {
-            int distance = abs(x - unit.x) + abs(y - unit.y);
-            if (distance >= 0 && distance <= range) {
-                // Check if tile is passable and no other unit (or current position)
-                bool canMove = true;
-                int otherUnit = GetUnitAtPosition(x, y);
-                if (otherUnit >= 0 && otherUnit != selectedUnitIndex) {
-                    canMove = false;
-                }
-                
-                if (canMove) {
-                    moveRangeTiles.push_back({x, y});
-                }
+
+    // Uniform-cost (Dijkstra) flood fill seeded at the unit. Expands only
+    // reachable tiles and respects terrain move costs, so forests and
+    // mountains shrink the range instead of being treated as plains.
+    // Priority queue holds (cost, tile index); smallest cost first.
+    std::priority_queue<std::pair<int, int>,
+                        std::vector<std::pair<int, int>>,
+                        std::greater<std::pair<int, int>>> frontier;
+
+    int startIndex = unit.y * mapWidth + unit.x;
+    moveCostGrid[startIndex] = 0;
+    frontier.push({0, startIndex});
+
+    const int dx[] = {1, -1, 0, 0};
+    const int dy[] = {0, 0, 1, -1};
+
+    while (!frontier.empty()) {
+        auto [cost, index] = frontier.top();
+        frontier.pop();
+
+        // Stale entry - a cheaper path to this tile was already expanded
+        if (cost > moveCostGrid[index]) continue;
+
+        int x = index % mapWidth;
+        int y = index / mapWidth;
+
+        for (int dir = 0; dir < 4; dir++) {
+            int nx = x + dx[dir];
+            int ny = y + dy[dir];
+            if (nx < 0 || ny < 0 || nx >= mapWidth || ny >= mapHeight) continue;
+
+            const TileType* terrain = GetTerrainAt(nx, ny);
+            if (terrain && !terrain->passable) continue;
+
+            // Enemy-occupied tiles block; teammates can be passed through
+            // but not stopped on (IsInMoveRange rejects those tiles).
+            // Same rule the enemy phase uses, so both sides path alike.
+            int otherUnit = GetUnitAtPosition(nx, ny);
+            if (otherUnit >= 0 && otherUnit != selectedUnitIndex &&
+                unitsHot[otherUnit].isPlayer != unit.isPlayer) continue;
+
+            int stepCost = (terrain && terrain->moveCost > 0) ? terrain->moveCost : 1;
+            int newCost = cost + stepCost;
+            if (newCost > range) continue;
+
+            int neighborIndex = ny * mapWidth + nx;
+            if (moveCostGrid[neighborIndex] < 0 || newCost < moveCostGrid[neighborIndex]) {
+                moveCostGrid[neighborIndex] = newCost;
+                frontier.push({newCost, neighborIndex});
             }
         }
     }
-    
-    std::cout << "Calculated " << moveRangeTiles.size() << " movement tiles" << std::endl;
+
+    int reachable = 0;
+    for (int cost : moveCostGrid) {
+        if (cost >= 0) reachable++;
+    }
+    std::cout << "Calculated " << reachable << " movement tiles" << std::endl;
 }
 
 void MapManager::CalculateAttackRange() {
-    attackRangeTiles.clear();
-    
-    if (selectedUnitIndex < 0) return;
-    
-    const MapUnit& unit = units[selectedUnitIndex];
-    int moveRange = unit.mov;
-    int attackRange = 2; // Default attack range
-    
-    // Calculate attack range from edge of movement range (and current position)
-    for (int my = 0; my < mapHeight; my++) {
-        for (int mx = 0; mx < mapWidth; mx++) {
-            int moveDist = abs(mx - unit.x) + abs(my - unit.y);
-            
-            // Skip if not within movement range (including current position)
-            if (moveDist > moveRange) continue;
-            
-            // From this movement position, calculate attack range
-            for (int ay = 0; ay < mapHeight; ay++) {
-                for (int ax = 0; ax < mapWidth; ax++) {
-                    int attackDist = abs(ax - mx) + abs(ay - my);
-                    if (attackDist >= 1 && attackDist <= attackRange) {
-                        // Check if this tile is in movement range (including current position)
-                        int distFromUnit = abs(ax - unit.x) + abs(ay - unit.y);
-                        bool inMoveRange = (distFromUnit >= 0 && distFromUnit <= moveRange);
-                        if (!inMoveRange) {
-                            // Check if already added
-                            bool alreadyAdded = false;
-                            for (const auto& tile : attackRangeTiles) {
-                                if (tile.first == ax && tile.second == ay) {
-                                    alreadyAdded = true;
-                                    break;
-                                }
-                            }
-                            if (!alreadyAdded) {
-                                attackRangeTiles.push_back({ax, ay});
-                            }
-                        }
-                    }
-                }
+    // Reuse the dedup grid between selections
+    attackRangeGrid.assign(mapWidth * mapHeight, 0);
+
+    if (selectedUnitIndex < 0 || moveCostGrid.empty()) return;
+
+    const MapUnitHot& unit = unitsHot[selectedUnitIndex];
+    const MapUnitCold& unitCold = unitsCold[selectedUnitIndex];
+
+    // Attack range comes from the equipped weapon, falling back to 1-2
+    int attackRange = 2;
+    if (unit.equippedItemIndex >= 0 && unit.equippedItemIndex < (int)unitCold.inventory.size()) {
+        const WeaponData& weapon = GetWeaponData(unitCold.inventory[unit.equippedItemIndex]);
+        if (!weapon.range.empty()) {
+            attackRange = *std::max_element(weapon.range.begin(), weapon.range.end());
+        }
+    }
+
+    // Multi-source BFS: seed the frontier with every reachable tile and
+    // expand outward up to the weapon range. Each tile is visited once,
+    // so this is O(tiles) instead of the old O(W^2 * H^2) rescan.
+    std::vector<int> attackDist(mapWidth * mapHeight, -1);
+    std::queue<int> frontier;
+
+    for (int index = 0; index < (int)moveCostGrid.size(); index++) {
+        if (moveCostGrid[index] >= 0) {
+            // Pass-through tiles under a teammate aren't attack origins:
+            // the unit can cross them but never attack from them
+            int occupant = occupancyGrid[index];
+            if (occupant >= 0 && occupant != selectedUnitIndex) continue;
+            attackDist[index] = 0;
+            frontier.push(index);
+        }
+    }
+
+    const int dx[] = {1, -1, 0, 0};
+    const int dy[] = {0, 0, 1, -1};
+
+    int attackTiles = 0;
+    while (!frontier.empty()) {
+        int index = frontier.front();
+        frontier.pop();
+
+        int dist = attackDist[index];
+        if (dist >= attackRange) continue;
+
+        int x = index % mapWidth;
+        int y = index / mapWidth;
+
+        for (int dir = 0; dir < 4; dir++) {
+            int nx = x + dx[dir];
+            int ny = y + dy[dir];
+            if (nx < 0 || ny < 0 || nx >= mapWidth || ny >= mapHeight) continue;
+
+            int neighborIndex = ny * mapWidth + nx;
+            if (attackDist[neighborIndex] >= 0) continue;
+
+            attackDist[neighborIndex] = dist + 1;
+            frontier.push(neighborIndex);
+
+            // Attack-only tiles are those outside the movement range
+            if (moveCostGrid[neighborIndex] < 0) {
+                attackRangeGrid[neighborIndex] = 1;
+                attackTiles++;
             }
         }
     }
-    
-    std::cout << "Calculated " << attackRangeTiles.size() << " attack tiles" << std::endl;
+
+    std::cout << "Calculated " << attackTiles << " attack tiles" << std::endl;
+}
+
+void MapManager::UpdateMovePath() {
+    // Path preview from the selected unit to the cursor. Instead of
+    // running a fresh A* per cursor move, backtrace the Dijkstra cost
+    // grid from CalculateMovementRange: starting at the cursor, step to
+    // any neighbor whose cost plus the cost of entering the current tile
+    // equals the current tile's cost. That neighbor lies on an optimal
+    // route, so the whole update is O(path length) per cursor step.
+    movePath.clear();
+    if (selectedUnitIndex < 0 || moveCostGrid.empty()) return;
+    if (cursorX < 0 || cursorY < 0 || cursorX >= mapWidth || cursorY >= mapHeight) return;
+
+    int index = cursorY * mapWidth + cursorX;
+    if (moveCostGrid[index] < 0) return;
+
+    const int dx[] = {1, -1, 0, 0};
+    const int dy[] = {0, 0, 1, -1};
+
+    movePath.push_back(index);
+    while (moveCostGrid[index] > 0) {
+        int x = index % mapWidth;
+        int y = index / mapWidth;
+        const TileType* terrain = GetTerrainAt(x, y);
+        int enterCost = (terrain && terrain->moveCost > 0) ? terrain->moveCost : 1;
+
+        int next = -1;
+        for (int dir = 0; dir < 4; dir++) {
+            int nx = x + dx[dir];
+            int ny = y + dy[dir];
+            if (nx < 0 || ny < 0 || nx >= mapWidth || ny >= mapHeight) continue;
+
+            int neighborIndex = ny * mapWidth + nx;
+            if (moveCostGrid[neighborIndex] >= 0 &&
+                moveCostGrid[neighborIndex] + enterCost == moveCostGrid[index]) {
+                next = neighborIndex;
+                break;
+            }
+        }
+
+        if (next < 0) {
+            // Grid and cursor disagree (shouldn't happen) - drop the preview
+            movePath.clear();
+            return;
+        }
+        movePath.push_back(next);
+        index = next;
+    }
+
+    std::reverse(movePath.begin(), movePath.end());
+}
+
+void MapManager::RenderMovePath(int scaledTileSize) {
+    // Draw the route as a translucent corridor through tile centers with
+    // a solid block on the destination (no dedicated arrow art yet)
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 255, 220, 80, 170);
+
+    int band = scaledTileSize / 3;
+    int half = band / 2;
+
+    for (size_t i = 0; i + 1 < movePath.size(); i++) {
+        int x0 = (movePath[i] % mapWidth) * scaledTileSize + scaledTileSize / 2 - cameraX;
+        int y0 = (movePath[i] / mapWidth) * scaledTileSize + scaledTileSize / 2 - cameraY;
+        int x1 = (movePath[i + 1] % mapWidth) * scaledTileSize + scaledTileSize / 2 - cameraX;
+        int y1 = (movePath[i + 1] / mapWidth) * scaledTileSize + scaledTileSize / 2 - cameraY;
+
+        SDL_Rect segment;
+        segment.x = std::min(x0, x1) - half;
+        segment.y = std::min(y0, y1) - half;
+        segment.w = std::abs(x1 - x0) + band;
+        segment.h = std::abs(y1 - y0) + band;
+        SDL_RenderFillRect(renderer, &segment);
+    }
+
+    int destX = (movePath.back() % mapWidth) * scaledTileSize + scaledTileSize / 2 - cameraX;
+    int destY = (movePath.back() / mapWidth) * scaledTileSize + scaledTileSize / 2 - cameraY;
+    SDL_Rect head = {destX - band, destY - band, band * 2, band * 2};
+    SDL_RenderFillRect(renderer, &head);
 }
 
 bool MapManager::IsInMoveRange(int x, int y) const {
-    // Check if it's in the movement range tiles
-    for (const auto& tile : moveRangeTiles) {
-        if (tile.first == x && tile.second == y) {
+    if (x < 0 || y < 0 || x >= mapWidth || y >= mapHeight) {
+        return false;
+    }
+    int index = y * mapWidth + x;
+    if (index < (int)moveCostGrid.size() && moveCostGrid[index] >= 0) {
+        // Reachable, but a tile under a teammate is pass-through only
+        int occupant = GetUnitAtPosition(x, y);
+        if (occupant < 0 || occupant == selectedUnitIndex) {
             return true;
         }
     }
     // Also allow staying at current position
     if (selectedUnitIndex >= 0) {
-        const auto& unit = units[selectedUnitIndex];
+        const auto& unit = unitsHot[selectedUnitIndex];
         if (x == unit.x && y == unit.y) {
             return true;
         }
@@ -917,13 +1579,217 @@ void MapManager::ConfirmAction() {
     } else if (selectedActionIndex == 1) {
         // Wait - finalize all inventory changes
         std::cout << "Unit waiting - inventory changes finalized" << std::endl;
-        units[selectedUnitIndex].hasMoved = true;
+        unitsHot[selectedUnitIndex].hasMoved = true;
         selectedUnitIndex = -1;
         showActionMenu = false;
-        
+
         // Clear inventory backup so changes are permanent
         originalInventory.clear();
         originalEquippedIndex = -1;
+
+        // Enemy phase once every living player unit has acted
+        bool allMoved = true;
+        for (const auto& unit : unitsHot) {
+            if (unit.isPlayer && unit.hp > 0 && !unit.hasMoved) {
+                allMoved = false;
+                break;
+            }
+        }
+        if (allMoved) {
+            RunEnemyPhase();
+        }
+    }
+}
+
+void MapManager::RunEnemyPhase() {
+    if (mapWidth <= 0 || mapHeight <= 0) return;
+
+    std::cout << "Enemy phase..." << std::endl;
+
+    // Snapshot the map for the AI workers
+    EnemyPhaseView view;
+    view.width = mapWidth;
+    view.height = mapHeight;
+    view.tileCost.resize(mapWidth * mapHeight, 1);
+    for (int y = 0; y < mapHeight; y++) {
+        for (int x = 0; x < mapWidth; x++) {
+            const TileType* terrain = GetTerrainAt(x, y);
+            if (terrain && !terrain->passable) {
+                view.tileCost[y * mapWidth + x] = 0;
+            } else if (terrain && terrain->moveCost > 0) {
+                view.tileCost[y * mapWidth + x] = terrain->moveCost;
+            }
+        }
+    }
+    view.occupancy = occupancyGrid;
+
+    // Resolve each unit's equipped weapon once: combat stat blocks for
+    // the forecast kernel plus max attack range for the candidate scan
+    std::vector<int> ranges(unitsHot.size(), 1);
+    std::vector<CombatantStats> stats(unitsHot.size());
+    for (size_t i = 0; i < unitsHot.size(); i++) {
+        const MapUnitHot& hot = unitsHot[i];
+        const MapUnitCold& cold = unitsCold[i];
+        uint16_t handle = WEAPON_HANDLE_NONE;
+        if (hot.equippedItemIndex >= 0 && hot.equippedItemIndex < (int)cold.inventory.size()) {
+            handle = FindWeaponHandle(cold.inventory[hot.equippedItemIndex]);
+        }
+        const WeaponData& weapon = GetWeaponByHandle(handle);
+        if (!weapon.range.empty()) {
+            ranges[i] = *std::max_element(weapon.range.begin(), weapon.range.end());
+        }
+        stats[i] = DamageCalculation::MakeStats(hot, weapon);
+    }
+
+    std::vector<EnemyAction> actions = EnemyStrategies::DecidePhase(view, unitsHot, stats, ranges);
+
+    // Apply in decision (unit-index) order, re-checking occupancy so two
+    // enemies that picked the same tile against the snapshot don't stack
+    for (const EnemyAction& action : actions) {
+        MapUnitHot& enemy = unitsHot[action.unitIndex];
+        if (enemy.hp <= 0) continue;
+
+        int destIndex = action.moveY * mapWidth + action.moveX;
+        int occupant = occupancyGrid[destIndex];
+        if (occupant < 0 || occupant == action.unitIndex) {
+            MoveUnitTo(action.unitIndex, action.moveX, action.moveY);
+        }
+
+        if (action.targetIndex >= 0) {
+            MapUnitHot& target = unitsHot[action.targetIndex];
+            int distance = std::abs(target.x - enemy.x) + std::abs(target.y - enemy.y);
+            if (target.hp > 0 && distance <= ranges[action.unitIndex]) {
+                CombatForecast forecast = DamageCalculation::Forecast(
+                    stats[action.unitIndex], stats[action.targetIndex]);
+                int damage = forecast.damage * forecast.hits;
+                target.hp -= damage;
+                std::cout << unitsCold[action.unitIndex].name << " attacks "
+                          << unitsCold[action.targetIndex].name << " for " << damage << " damage" << std::endl;
+                if (target.hp <= 0) {
+                    target.hp = 0;
+                    std::cout << unitsCold[action.targetIndex].name << " falls!" << std::endl;
+                }
+            }
+        }
+    }
+
+    // Remove the fallen, then start the next player turn
+    for (int i = (int)unitsHot.size() - 1; i >= 0; i--) {
+        if (unitsHot[i].hp <= 0) {
+            unitsHot.erase(unitsHot.begin() + i);
+            unitsCold.erase(unitsCold.begin() + i);
+        }
+    }
+    RebuildOccupancyGrid();
+
+    for (auto& unit : unitsHot) {
+        unit.hasMoved = false;
+    }
+    turnNumber++;
+    std::cout << "Enemy phase complete - turn " << turnNumber << std::endl;
+
+    if (onTurnEnd) {
+        onTurnEnd();
+    }
+}
+
+uint16_t MapManager::LoadSpriteFrames(const std::string& spritePath) {
+    auto it = animIndexBySheet.find(spritePath);
+    if (it != animIndexBySheet.end()) {
+        return it->second;
+    }
+
+    TextureManager::AtlasRegion sheet = textureManager->LoadIntoAtlas(spritePath);
+    if (!sheet.IsValid()) {
+        animIndexBySheet[spritePath] = SPRITE_ANIM_NONE;  // Don't retry the disk
+        return SPRITE_ANIM_NONE;
+    }
+
+    // Slice the packed region into frames; the frames share the sheet's
+    // atlas page, so switching frames never switches textures
+    int frameCount = 1;
+    if (sheet.src.h > 0 && sheet.src.w % sheet.src.h == 0) {
+        frameCount = sheet.src.w / sheet.src.h;
+    }
+    int frameWidth = sheet.src.w / frameCount;
+
+    SpriteFrames table;
+    table.frames.reserve(frameCount);
+    for (int i = 0; i < frameCount; i++) {
+        TextureManager::AtlasRegion frame = sheet;
+        frame.src.x = sheet.src.x + i * frameWidth;
+        frame.src.w = frameWidth;
+        table.frames.push_back(frame);
+    }
+
+    uint16_t handle = static_cast<uint16_t>(animTable.size());
+    animTable.push_back(std::move(table));
+    animIndexBySheet[spritePath] = handle;
+    return handle;
+}
+
+void MapManager::Update(float deltaTime) {
+    (void)deltaTime;  // Caller runs us on the fixed step; one tick per call
+
+    // Advance every unit's animation in one pass over the hot array:
+    // two byte counters per unit, no virtual dispatch, no texture work
+    for (auto& unit : unitsHot) {
+        if (unit.animHandle == SPRITE_ANIM_NONE) continue;
+        const SpriteFrames& anim = animTable[unit.animHandle];
+        if (anim.frames.size() <= 1) continue;
+
+        if (++unit.animTicks >= ANIM_TICKS_PER_FRAME) {
+            unit.animTicks = 0;
+            unit.animFrame = static_cast<uint8_t>((unit.animFrame + 1) % anim.frames.size());
+        }
+    }
+}
+
+void MapManager::CaptureSaveData(SaveData& out) const {
+    out.slot_name = mapName + " - Turn " + std::to_string(turnNumber);
+    out.timestamp = std::time(nullptr);
+    out.turn_count = turnNumber;
+    out.is_mid_battle = true;
+    out.current_map = mapFilePath;
+
+    out.units.clear();
+    out.units.reserve(unitsHot.size());
+    out.unit_positions.clear();
+    out.unit_positions.reserve(unitsHot.size());
+
+    for (size_t i = 0; i < unitsHot.size(); i++) {
+        const MapUnitHot& hot = unitsHot[i];
+        const MapUnitCold& cold = unitsCold[i];
+
+        UnitSaveData unit;
+        unit.character_id = StringInterner::Intern(cold.unitId);
+        unit.unit_name = cold.name;
+        unit.class_name = StringInterner::Intern(cold.className);
+        unit.level = hot.level;
+        unit.experience = 0;
+        unit.hp_current = hot.hp;
+        unit.hp_max = hot.maxHp;
+        unit.str = hot.str;
+        unit.mag = hot.mag;
+        unit.skl = hot.skl;
+        unit.spd = hot.spd;
+        unit.lck = hot.lck;
+        unit.def = hot.def;
+        unit.res = hot.res;
+        unit.is_alive = hot.hp > 0;
+        unit.is_recruited = hot.isPlayer;
+
+        unit.inventory.reserve(cold.inventory.size());
+        for (size_t j = 0; j < cold.inventory.size(); j++) {
+            ItemData item;
+            item.item_id = cold.inventory[j];  // Already interned handles
+            item.uses_remaining = GetWeaponData(cold.inventory[j]).durability;
+            item.is_equipped = ((int)j == hot.equippedItemIndex);
+            unit.inventory.push_back(item);
+        }
+
+        out.units.push_back(std::move(unit));
+        out.unit_positions.push_back({StringInterner::Intern(cold.unitId), {hot.x, hot.y}});
     }
 }
 
@@ -931,8 +1797,7 @@ void MapManager::CancelActionMenu() {
     if (!showActionMenu || selectedUnitIndex < 0) return;
     
     // Restore unit to original position
-    units[selectedUnitIndex].x = originalUnitX;
-    units[selectedUnitIndex].y = originalUnitY;
+    MoveUnitTo(selectedUnitIndex, originalUnitX, originalUnitY);
     
     // Move cursor back to unit position
     cursorX = originalUnitX;
@@ -942,9 +1807,10 @@ void MapManager::CancelActionMenu() {
     showActionMenu = false;
     selectedActionIndex = 0;
     
-    // Restore movement ranges
+    // Restore movement ranges and path preview
     CalculateMovementRange();
     CalculateAttackRange();
+    UpdateMovePath();
     
     std::cout << "Cancelled action, unit returned to (" << originalUnitX << ", " << originalUnitY << ")" << std::endl;
 }
@@ -955,22 +1821,21 @@ void MapManager::OpenInventory() {
     inventoryUnitIndex = selectedUnitIndex;
     
     // Backup current inventory state for potential cancellation
-    const auto& unit = units[inventoryUnitIndex];
-    originalInventory = unit.inventory;
-    originalEquippedIndex = unit.equippedItemIndex;
-    
+    originalInventory = unitsCold[inventoryUnitIndex].inventory;
+    originalEquippedIndex = unitsHot[inventoryUnitIndex].equippedItemIndex;
+
     showInventoryMenu = true;
     showActionMenu = false;
     showDropConfirmation = false;
     selectedInventoryIndex = 0;
-    std::cout << "Opening inventory for unit: " << units[inventoryUnitIndex].name << std::endl;
+    std::cout << "Opening inventory for unit: " << unitsCold[inventoryUnitIndex].name << std::endl;
 }
 
 void MapManager::CloseInventory() {
     // Restore original inventory if backing out
-    if (inventoryUnitIndex >= 0 && inventoryUnitIndex < (int)units.size()) {
-        units[inventoryUnitIndex].inventory = originalInventory;
-        units[inventoryUnitIndex].equippedItemIndex = originalEquippedIndex;
+    if (inventoryUnitIndex >= 0 && inventoryUnitIndex < (int)unitsCold.size()) {
+        unitsCold[inventoryUnitIndex].inventory = originalInventory;
+        unitsHot[inventoryUnitIndex].equippedItemIndex = originalEquippedIndex;
         std::cout << "Inventory changes cancelled, restored original state" << std::endl;
     }
     
@@ -989,7 +1854,7 @@ void MapManager::CloseInventory() {
 void MapManager::MoveInventorySelection(int delta) {
     if (!showInventoryMenu || inventoryUnitIndex < 0) return;
     
-    const auto& unit = units[inventoryUnitIndex];
+    const auto& unit = unitsCold[inventoryUnitIndex];
     int maxIndex = unit.inventory.size() + 1; // +2 for Equip/Drop actions, but showing 1-indexed
     
     selectedInventoryIndex += delta;
@@ -1005,32 +1870,34 @@ void MapManager::CancelDropConfirmation() {
 void MapManager::ConfirmInventoryAction() {
     if (!showInventoryMenu || inventoryUnitIndex < 0) return;
     
-    auto& unit = units[inventoryUnitIndex];
-    
+    MapUnitHot& unitHot = unitsHot[inventoryUnitIndex];
+    MapUnitCold& unit = unitsCold[inventoryUnitIndex];
+
     if (showDropConfirmation) {
         // User is confirming the drop - this persists even if they back out (only reverts on action menu cancel)
-        if (unit.equippedItemIndex >= 0 && unit.equippedItemIndex < (int)unit.inventory.size()) {
-            std::string droppedItem = unit.inventory[unit.equippedItemIndex];
+        if (unitHot.equippedItemIndex >= 0 && unitHot.equippedItemIndex < (int)unit.inventory.size()) {
+            uint32_t droppedItem = unit.inventory[unitHot.equippedItemIndex];
             WeaponData weaponData = GetWeaponData(droppedItem);
-            unit.inventory.erase(unit.inventory.begin() + unit.equippedItemIndex);
-            
+            unit.inventory.erase(unit.inventory.begin() + unitHot.equippedItemIndex);
+
             // Try to equip the first wieldable weapon, or -1 if none
-            unit.equippedItemIndex = -1;
+            unitHot.equippedItemIndex = -1;
             for (int i = 0; i < (int)unit.inventory.size(); i++) {
                 WeaponData nextWeapon = GetWeaponData(unit.inventory[i]);
                 if (CanUnitWieldWeapon(unit, nextWeapon)) {
-                    unit.equippedItemIndex = i;
+                    unitHot.equippedItemIndex = i;
                     std::cout << "Auto-equipped: " << nextWeapon.name << std::endl;
                     break;
                 }
             }
-            
+
             std::cout << "Dropped: " << weaponData.name << " (persists until action menu cancel)" << std::endl;
-            
+
             // Update backup so drop persists when closing inventory
             originalInventory = unit.inventory;
-            originalEquippedIndex = unit.equippedItemIndex;
-            
+            originalEquippedIndex = unitHot.equippedItemIndex;
+            MarkThreatDirty(inventoryUnitIndex);
+
             // Adjust selection if needed
             if (selectedInventoryIndex >= (int)unit.inventory.size() + 1) {
                 selectedInventoryIndex = unit.inventory.size();
@@ -1039,148 +1906,169 @@ void MapManager::ConfirmInventoryAction() {
         showDropConfirmation = false;
         return;
     }
-    
+
     if (selectedInventoryIndex < (int)unit.inventory.size()) {
         // Check if unit can wield this weapon
         WeaponData weaponData = GetWeaponData(unit.inventory[selectedInventoryIndex]);
         if (CanUnitWieldWeapon(unit, weaponData)) {
             // Equip item - update backup immediately
-            unit.equippedItemIndex = selectedInventoryIndex;
+            unitHot.equippedItemIndex = selectedInventoryIndex;
             originalEquippedIndex = selectedInventoryIndex;
+            MarkThreatDirty(inventoryUnitIndex);
             std::cout << "Equipped: " << weaponData.name << std::endl;
         } else {
             std::cout << "Cannot equip " << weaponData.name << " - " << unit.name << " cannot wield " << weaponData.type << "s" << std::endl;
         }
     } else if (selectedInventoryIndex == (int)unit.inventory.size()) {
         // Show drop confirmation
-        if (unit.equippedItemIndex >= 0 && unit.equippedItemIndex < (int)unit.inventory.size()) {
+        if (unitHot.equippedItemIndex >= 0 && unitHot.equippedItemIndex < (int)unit.inventory.size()) {
             showDropConfirmation = true;
             std::cout << "Confirming drop..." << std::endl;
         }
     }
 }
 
-WeaponData MapManager::GetWeaponData(const std::string& weaponId) const {
-    WeaponData weaponData;
-    weaponData.id = weaponId;
-    weaponData.name = weaponId;  // Default to ID if not found
-    
-    // New structure: { "generic": { "sword": [...], "axe": [...] }, "prf": { "sword": [...] } }
-    // Search in generic weapons (organized by weapon type)
-    if (weaponsData.contains("generic") && weaponsData["generic"].is_object()) {
-        for (auto& [weaponType, weaponArray] : weaponsData["generic"].items()) {
-            if (weaponArray.is_array()) {
-                for (const auto& weapon : weaponArray) {
-                    if (weapon.value("id", "") == weaponId) {
-                        weaponData.name = weapon.value("name", weaponId);
-                        weaponData.type = weaponType; // Type is the key (sword, axe, anima, etc.)
-                        weaponData.might = weapon.value("might", 0);
-                        weaponData.hit = weapon.value("hit", 0);
-                        weaponData.crit = weapon.value("crit", 0);
-                        weaponData.weight = weapon.value("weight", 0);
-                        weaponData.durability = weapon.contains("durability") && weapon["durability"].is_null() ? -1 : weapon.value("durability", 0);
-                        if (weapon.contains("range") && weapon["range"].is_array()) {
-                            for (const auto& r : weapon["range"]) {
-                                weaponData.range.push_back(r.get<int>());
-                            }
-                        }
-                        weaponData.isPRF = false;
-                        return weaponData;
+void MapManager::BuildWeaponTable(const json& weaponsData) {
+    weaponTable.clear();
+    weaponIndex.clear();
+    weaponIndexByItem.clear();
+
+    // Every section shares the layout { "<type>": [ {weapon}, ... ] },
+    // with the weapon type as the key (sword, axe, anima, etc.)
+    auto parseSection = [this](const json& section, bool isPRF) {
+        if (!section.is_object()) return;
+        for (auto& [weaponType, weaponArray] : section.items()) {
+            if (!weaponArray.is_array()) continue;
+            for (const auto& weapon : weaponArray) {
+                WeaponData data;
+                data.id = weapon.value("id", "");
+                if (data.id.empty() || weaponIndex.count(data.id)) continue;
+
+                data.name = weapon.value("name", data.id);
+                data.type = weaponType;
+                data.might = weapon.value("might", 0);
+                data.hit = weapon.value("hit", 0);
+                data.crit = weapon.value("crit", 0);
+                data.weight = weapon.value("weight", 0);
+                data.durability = weapon.contains("durability") && weapon["durability"].is_null() ? -1 : weapon.value("durability", 0);
+                if (weapon.contains("range") && weapon["range"].is_array()) {
+                    for (const auto& r : weapon["range"]) {
+                        data.range.push_back(r.get<int>());
                     }
                 }
-            }
-        }
-    }
-    
-    // Search in PRF weapons (organized by weapon type)
-    if (weaponsData.contains("prf") && weaponsData["prf"].is_object()) {
-        for (auto& [weaponType, weaponArray] : weaponsData["prf"].items()) {
-            if (weaponArray.is_array()) {
-                for (const auto& weapon : weaponArray) {
-                    if (weapon.value("id", "") == weaponId) {
-                        weaponData.name = weapon.value("name", weaponId);
-                        weaponData.type = weaponType; // Type is the key (sword, dark, stone, etc.)
-                        weaponData.might = weapon.value("might", 0);
-                        weaponData.hit = weapon.value("hit", 0);
-                        weaponData.crit = weapon.value("crit", 0);
-                        weaponData.weight = weapon.value("weight", 0);
-                        weaponData.durability = weapon.contains("durability") && weapon["durability"].is_null() ? -1 : weapon.value("durability", 0);
-                        if (weapon.contains("range") && weapon["range"].is_array()) {
-                            for (const auto& r : weapon["range"]) {
-                                weaponData.range.push_back(r.get<int>());
-                            }
-                        }
-                        weaponData.user = weapon.value("user", "");
-                        weaponData.isPRF = true;
-                        return weaponData;
-                    }
+                if (isPRF) {
+                    data.user = weapon.value("user", "");
                 }
+                data.isPRF = isPRF;
+
+                uint16_t slot = static_cast<uint16_t>(weaponTable.size());
+                weaponIndex[data.id] = slot;
+                weaponIndexByItem[StringInterner::Intern(data.id)] = slot;
+                weaponTable.push_back(std::move(data));
             }
         }
-    }
-    
-    // Search in attributed weapons (if exists - organized by weapon type)
-    if (weaponsData.contains("attributed") && weaponsData["attributed"].is_object()) {
-        for (auto& [weaponType, weaponArray] : weaponsData["attributed"].items()) {
-            if (weaponArray.is_array()) {
-                for (const auto& weapon : weaponArray) {
-                    if (weapon.value("id", "") == weaponId) {
-                        weaponData.name = weapon.value("name", weaponId);
-                        weaponData.type = weaponType;
-                        weaponData.might = weapon.value("might", 0);
-                        weaponData.hit = weapon.value("hit", 0);
-                        weaponData.crit = weapon.value("crit", 0);
-                        weaponData.weight = weapon.value("weight", 0);
-                        weaponData.durability = weapon.contains("durability") && weapon["durability"].is_null() ? -1 : weapon.value("durability", 0);
-                        if (weapon.contains("range") && weapon["range"].is_array()) {
-                            for (const auto& r : weapon["range"]) {
-                                weaponData.range.push_back(r.get<int>());
-                            }
-                        }
-                        weaponData.isPRF = false;
-                        return weaponData;
-                    }
-                }
+    };
+
+    if (weaponsData.contains("generic")) parseSection(weaponsData["generic"], false);
+    if (weaponsData.contains("prf")) parseSection(weaponsData["prf"], true);
+    if (weaponsData.contains("attributed")) parseSection(weaponsData["attributed"], false);
+
+    std::cout << "Indexed " << weaponTable.size() << " weapons" << std::endl;
+}
+
+void MapManager::BuildClassTable(const json& classesData) {
+    classTable.clear();
+    classIndex.clear();
+    classNameIndex.clear();
+
+    if (!classesData.is_object()) return;
+
+    for (auto& [classId, classArray] : classesData.items()) {
+        if (!classArray.is_array() || classArray.empty()) continue;
+        const json& entry = classArray[0];
+
+        ClassData data;
+        data.id = classId;
+        data.name = entry.value("name", classId);
+        if (entry.contains("weapon_types") && entry["weapon_types"].is_array()) {
+            for (const auto& wType : entry["weapon_types"]) {
+                data.weaponTypes.push_back(wType.get<std::string>());
             }
         }
+
+        uint16_t slot = static_cast<uint16_t>(classTable.size());
+        classIndex[data.id] = slot;
+        classNameIndex[data.name] = slot;  // Units store the display name
+        classTable.push_back(std::move(data));
     }
-    
-    return weaponData;
+
+    std::cout << "Indexed " << classTable.size() << " classes" << std::endl;
+}
+
+uint16_t MapManager::FindWeaponHandle(const std::string& weaponId) const {
+    auto it = weaponIndex.find(weaponId);
+    return it != weaponIndex.end() ? it->second : WEAPON_HANDLE_NONE;
 }
 
-bool MapManager::CanUnitWieldWeapon(const MapUnit& unit, const WeaponData& weapon) const {
+uint16_t MapManager::FindWeaponHandle(uint32_t itemId) const {
+    // Interned-handle lookup: integer hash, no string compare
+    auto it = weaponIndexByItem.find(itemId);
+    return it != weaponIndexByItem.end() ? it->second : WEAPON_HANDLE_NONE;
+}
+
+const WeaponData& MapManager::GetWeaponByHandle(uint16_t handle) const {
+    static const WeaponData empty;
+    return handle < weaponTable.size() ? weaponTable[handle] : empty;
+}
+
+const WeaponData& MapManager::GetWeaponData(const std::string& weaponId) const {
+    uint16_t handle = FindWeaponHandle(weaponId);
+    if (handle != WEAPON_HANDLE_NONE) {
+        return weaponTable[handle];
+    }
+
+    // Unknown id: keep the old behavior of displaying the id itself.
+    // The fallback is overwritten by the next miss, so callers that hold
+    // a weapon across further lookups take a copy.
+    unknownWeapon = WeaponData();
+    unknownWeapon.id = weaponId;
+    unknownWeapon.name = weaponId;
+    return unknownWeapon;
+}
+
+const WeaponData& MapManager::GetWeaponData(uint32_t itemId) const {
+    uint16_t handle = FindWeaponHandle(itemId);
+    if (handle != WEAPON_HANDLE_NONE) {
+        return weaponTable[handle];
+    }
+    return GetWeaponData(StringInterner::Lookup(itemId));
+}
+
+bool MapManager::CanUnitWieldWeapon(const MapUnitCold& unit, const WeaponData& weapon) const {
     // Check if it's a PRF weapon
     if (weapon.isPRF && !weapon.user.empty()) {
         return weapon.user == unit.unitId;
     }
-    
-    // Need to search by display name or store the class ID separately
-    // For now, search through all classes to find one with matching display name
-    for (auto& [classId, classArray] : classesData.items()) {
-        if (classArray.is_array() && !classArray.empty()) {
-            std::string displayName = classArray[0].value("name", "");
-            if (displayName == unit.className && classArray[0].contains("weapon_types")) {
-                const auto& weaponTypes = classArray[0]["weapon_types"];
-                if (weaponTypes.is_array()) {
-                    for (const auto& wType : weaponTypes) {
-                        if (wType.get<std::string>() == weapon.type) {
-                            return true;
-                        }
-                    }
-                }
-            }
+
+    // Units store the class display name, so go through the name index
+    auto it = classNameIndex.find(unit.className);
+    if (it == classNameIndex.end()) {
+        return false;
+    }
+
+    const ClassData& unitClass = classTable[it->second];
+    for (const std::string& wType : unitClass.weaponTypes) {
+        if (wType == weapon.type) {
+            return true;
         }
     }
-    
     return false;
 }
 
 std::string MapManager::GetClassDisplayName(const std::string& classId) const {
-    if (classesData.contains(classId) && classesData[classId].is_array()) {
-        const auto& classArray = classesData[classId];
-        if (!classArray.empty() && classArray[0].contains("name")) {
-            return classArray[0]["name"].get<std::string>();
-        }
+    auto it = classIndex.find(classId);
+    if (it != classIndex.end()) {
+        return classTable[it->second].name;
     }
     return classId; // Fallback to ID if not found
 }
@@ -1196,7 +2084,153 @@ void MapManager::ToggleUnitInfo() {
         if (unitIndex >= 0) {
             showUnitInfo = true;
             unitInfoIndex = unitIndex;
-            std::cout << "Showing info for: " << units[unitIndex].name << std::endl;
+            std::cout << "Showing info for: " << unitsCold[unitIndex].name << std::endl;
+        }
+    }
+}
+
+void MapManager::ToggleDangerZone() {
+    showDangerZone = !showDangerZone;
+    std::cout << (showDangerZone ? "Danger zone shown" : "Danger zone hidden") << std::endl;
+}
+
+void MapManager::MarkThreatDirty(int unitIndex) {
+    if (unitIndex >= 0 && unitIndex < (int)threatDirty.size()) {
+        threatDirty[unitIndex] = 1;
+    }
+}
+
+void MapManager::ResetDangerZone() {
+    threatGridPerUnit.assign(unitsHot.size(), {});
+    threatDirty.assign(unitsHot.size(), 1);
+    dangerGrid.assign(mapWidth * mapHeight, 0);
+}
+
+void MapManager::UpdateDangerZone() {
+    if (threatGridPerUnit.size() != unitsHot.size()) {
+        ResetDangerZone();
+    }
+
+    // Only units flagged dirty since the last query get recomputed: their
+    // old grid is subtracted from the merged counters, the threat is
+    // redone from their current position and weapon, and the result added
+    // back. Everyone else's contribution is untouched.
+    for (size_t i = 0; i < unitsHot.size(); i++) {
+        if (!threatDirty[i]) continue;
+
+        std::vector<uint8_t>& grid = threatGridPerUnit[i];
+        for (size_t t = 0; t < grid.size(); t++) {
+            if (grid[t]) dangerGrid[t]--;
+        }
+
+        if (!unitsHot[i].isPlayer && unitsHot[i].hp > 0) {
+            ComputeUnitThreat((int)i, grid);
+            for (size_t t = 0; t < grid.size(); t++) {
+                if (grid[t]) dangerGrid[t]++;
+            }
+        } else {
+            grid.clear();
+        }
+
+        threatDirty[i] = 0;
+    }
+}
+
+void MapManager::ComputeUnitThreat(int unitIndex, std::vector<uint8_t>& outGrid) const {
+    outGrid.assign(mapWidth * mapHeight, 0);
+    if (mapWidth <= 0 || mapHeight <= 0) return;
+
+    const MapUnitHot& unit = unitsHot[unitIndex];
+    const MapUnitCold& unitCold = unitsCold[unitIndex];
+
+    // Threat is terrain-only on purpose: ignoring unit blocking makes a
+    // unit's grid depend solely on its own position and equipment, which
+    // is what lets the dirty flags skip everyone who hasn't changed.
+    std::vector<int> cost(mapWidth * mapHeight, -1);
+    std::priority_queue<std::pair<int, int>,
+                        std::vector<std::pair<int, int>>,
+                        std::greater<std::pair<int, int>>> frontier;
+
+    int startIndex = unit.y * mapWidth + unit.x;
+    if (startIndex < 0 || startIndex >= (int)cost.size()) return;
+    cost[startIndex] = 0;
+    frontier.push({0, startIndex});
+
+    const int dx[] = {1, -1, 0, 0};
+    const int dy[] = {0, 0, 1, -1};
+
+    while (!frontier.empty()) {
+        auto [tileCost, index] = frontier.top();
+        frontier.pop();
+        if (tileCost > cost[index]) continue;
+
+        int x = index % mapWidth;
+        int y = index / mapWidth;
+
+        for (int dir = 0; dir < 4; dir++) {
+            int nx = x + dx[dir];
+            int ny = y + dy[dir];
+            if (nx < 0 || ny < 0 || nx >= mapWidth || ny >= mapHeight) continue;
+
+            const TileType* terrain = GetTerrainAt(nx, ny);
+            if (terrain && !terrain->passable) continue;
+
+            int stepCost = (terrain && terrain->moveCost > 0) ? terrain->moveCost : 1;
+            int newCost = tileCost + stepCost;
+            if (newCost > unit.mov) continue;
+
+            int neighborIndex = ny * mapWidth + nx;
+            if (cost[neighborIndex] < 0 || newCost < cost[neighborIndex]) {
+                cost[neighborIndex] = newCost;
+                frontier.push({newCost, neighborIndex});
+            }
+        }
+    }
+
+    // Attack range from the equipped weapon, same 1-2 fallback as the
+    // player-side range display
+    int attackRange = 2;
+    if (unit.equippedItemIndex >= 0 && unit.equippedItemIndex < (int)unitCold.inventory.size()) {
+        const WeaponData& weapon = GetWeaponData(unitCold.inventory[unit.equippedItemIndex]);
+        if (!weapon.range.empty()) {
+            attackRange = *std::max_element(weapon.range.begin(), weapon.range.end());
+        }
+    }
+
+    // Multi-source BFS outward from every reachable tile, mirroring
+    // CalculateAttackRange; any tile within weapon range is threatened
+    std::vector<int> attackDist(mapWidth * mapHeight, -1);
+    std::queue<int> expansion;
+
+    for (int index = 0; index < (int)cost.size(); index++) {
+        if (cost[index] >= 0) {
+            attackDist[index] = 0;
+            outGrid[index] = 1;
+            expansion.push(index);
+        }
+    }
+
+    while (!expansion.empty()) {
+        int index = expansion.front();
+        expansion.pop();
+
+        int dist = attackDist[index];
+        if (dist >= attackRange) continue;
+
+        int x = index % mapWidth;
+        int y = index / mapWidth;
+
+        for (int dir = 0; dir < 4; dir++) {
+            int nx = x + dx[dir];
+            int ny = y + dy[dir];
+            if (nx < 0 || ny < 0 || nx >= mapWidth || ny >= mapHeight) continue;
+
+            int neighborIndex = ny * mapWidth + nx;
+            if (attackDist[neighborIndex] >= 0) continue;
+
+            attackDist[neighborIndex] = dist + 1;
+            outGrid[neighborIndex] = 1;
+            expansion.push(neighborIndex);
         }
     }
 }
@@ -0,0 +1,157 @@
+#include "Profiler.hpp"
+#include "RenderManager.hpp"
+#include <cstdio>
+#include <iostream>
+
+namespace Lehran {
+
+Profiler::Profiler()
+    : hudVisible(false), capturing(false), frameNumber(0),
+      frameHistoryPos(0), frameStart(0), lastFrameMs(0.0) {
+    for (int i = 0; i < FRAME_HISTORY; i++) {
+        frameHistory[i] = 0.0;
+    }
+}
+
+Profiler::~Profiler() {
+    if (captureFile.is_open()) {
+        captureFile.close();
+    }
+}
+
+size_t Profiler::GetZoneIndex(const char* name) {
+    auto it = zoneIndex.find(name);
+    if (it != zoneIndex.end()) {
+        return it->second;
+    }
+    size_t index = zones.size();
+    zones.push_back({name, 0.0});
+    zoneIndex[name] = index;
+    return index;
+}
+
+Profiler::Zone::Zone(Profiler* profiler, const char* name)
+    : profiler(profiler), index(profiler->GetZoneIndex(name)),
+      start(SDL_GetPerformanceCounter()) {
+}
+
+Profiler::Zone::~Zone() {
+    Uint64 end = SDL_GetPerformanceCounter();
+    double ms = (double)(end - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+    profiler->zones[index].frameMs += ms;
+}
+
+void Profiler::BeginFrame() {
+    for (auto& zone : zones) {
+        zone.frameMs = 0.0;
+    }
+    frameStart = SDL_GetPerformanceCounter();
+}
+
+void Profiler::EndFrame() {
+    Uint64 end = SDL_GetPerformanceCounter();
+    lastFrameMs = (double)(end - frameStart) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+
+    frameHistory[frameHistoryPos] = lastFrameMs;
+    frameHistoryPos = (frameHistoryPos + 1) % FRAME_HISTORY;
+    frameNumber++;
+
+    if (capturing) {
+        WriteCaptureRow();
+    }
+}
+
+void Profiler::ToggleCapture(const std::string& path) {
+    if (capturing) {
+        capturing = false;
+        captureFile.close();
+        std::cout << "Profiler capture written: " << capturePath << std::endl;
+        return;
+    }
+
+    capturePath = path;
+    captureFile.open(path, std::ios::trunc);
+    if (!captureFile.is_open()) {
+        std::cerr << "WARNING: Could not open profiler capture file: " << path << std::endl;
+        return;
+    }
+    capturing = true;
+    WriteCaptureHeader();
+    std::cout << "Profiler capture started: " << path << std::endl;
+}
+
+void Profiler::WriteCaptureHeader() {
+    captureFile << "frame,frame_ms";
+    for (const auto& zone : zones) {
+        captureFile << "," << zone.name;
+    }
+    captureFile << "\n";
+}
+
+void Profiler::WriteCaptureRow() {
+    char value[32];
+    snprintf(value, sizeof(value), "%d,%.3f", frameNumber, lastFrameMs);
+    captureFile << value;
+    for (const auto& zone : zones) {
+        snprintf(value, sizeof(value), ",%.3f", zone.frameMs);
+        captureFile << value;
+    }
+    captureFile << "\n";
+}
+
+void Profiler::RenderHUD(RenderManager* renderManager, SDL_Renderer* renderer, TTF_Font* font) {
+    if (!hudVisible) return;
+
+    // Backing panel
+    int panelHeight = 80 + (int)zones.size() * 28;
+    SDL_Rect panel = {10, 10, 360, panelHeight};
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+    SDL_RenderFillRect(renderer, &panel);
+
+    char line[96];
+    snprintf(line, sizeof(line), "Frame: %.2f ms (%.0f fps)%s",
+             lastFrameMs, lastFrameMs > 0.0 ? 1000.0 / lastFrameMs : 0.0,
+             capturing ? " [REC]" : "");
+    renderManager->RenderText(line, panel.x + 170, panel.y + 20, font, {255, 255, 100, 255});
+
+    int y = panel.y + 48;
+    for (const auto& zone : zones) {
+        snprintf(line, sizeof(line), "%s: %.2f ms", zone.name.c_str(), zone.frameMs);
+        renderManager->RenderText(line, panel.x + 170, y, font, {220, 220, 220, 255});
+        y += 28;
+    }
+
+    // Frame-time graph: one bar per recent frame, scaled so 33 ms fills it
+    SDL_Rect graph = {panel.x, panel.y + panelHeight + 10, 360, 60};
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+    SDL_RenderFillRect(renderer, &graph);
+
+    const double scaleMs = 33.0;
+    int barWidth = graph.w / FRAME_HISTORY;
+    if (barWidth < 1) barWidth = 1;
+    for (int i = 0; i < FRAME_HISTORY; i++) {
+        double ms = frameHistory[(frameHistoryPos + i) % FRAME_HISTORY];
+        int barHeight = (int)(ms / scaleMs * graph.h);
+        if (barHeight > graph.h) barHeight = graph.h;
+        if (barHeight < 1) barHeight = 1;
+
+        // Green under 16 ms, yellow under 33 ms, red above
+        if (ms <= 16.0) {
+            SDL_SetRenderDrawColor(renderer, 100, 220, 100, 255);
+        } else if (ms <= 33.0) {
+            SDL_SetRenderDrawColor(renderer, 220, 220, 100, 255);
+        } else {
+            SDL_SetRenderDrawColor(renderer, 220, 100, 100, 255);
+        }
+
+        SDL_Rect bar = {graph.x + i * barWidth, graph.y + graph.h - barHeight, barWidth, barHeight};
+        SDL_RenderFillRect(renderer, &bar);
+    }
+
+    // 16 ms reference line
+    int refY = graph.y + graph.h - (int)(16.0 / scaleMs * graph.h);
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 120);
+    SDL_RenderDrawLine(renderer, graph.x, refY, graph.x + graph.w, refY);
+}
+
+} // namespace Lehran
@@ -4,9 +4,9 @@
 
 namespace Lehran {
 
-RenderManager::RenderManager(SDL_Renderer* renderer, TTF_Font* fontLarge, 
+RenderManager::RenderManager(SDL_Renderer* renderer, TextCache* textCache, TTF_Font* fontLarge,
                              TTF_Font* fontMedium, TTF_Font* fontSmall)
-    : renderer(renderer), fontLarge(fontLarge), fontMedium(fontMedium), fontSmall(fontSmall) {
+    : renderer(renderer), textCache(textCache), fontLarge(fontLarge), fontMedium(fontMedium), fontSmall(fontSmall) {
 }
 
 RenderManager::~RenderManager() {
@@ -242,36 +242,23 @@ void RenderManager::RenderSettings(const ConfigManager& config, int selectedSett
 void RenderManager::RenderText(const char* text, int x, int y, TTF_Font* font, SDL_Color color, bool alignRight) {
     if (!font || !text) return;
 
-    SDL_Surface* surface = TTF_RenderText_Blended(font, text, color);
-    if (!surface) return;
-
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (!texture) {
-        SDL_FreeSurface(surface);
-        return;
-    }
-
-    // Set texture alpha if color has alpha component
-    if (color.a < 255) {
-        SDL_SetTextureAlphaMod(texture, color.a);
-    }
+    int textWidth, textHeight;
+    SDL_Texture* texture = textCache->GetTexture(text, font, color, textWidth, textHeight);
+    if (!texture) return;
 
     SDL_Rect destRect;
-    destRect.w = surface->w;
-    destRect.h = surface->h;
+    destRect.w = textWidth;
+    destRect.h = textHeight;
 
     if (alignRight) {
-        destRect.x = x - surface->w;
-        destRect.y = y - surface->h;
+        destRect.x = x - textWidth;
+        destRect.y = y - textHeight;
     } else {
-        destRect.x = x - surface->w / 2;
-        destRect.y = y - surface->h / 2;
+        destRect.x = x - textWidth / 2;
+        destRect.y = y - textHeight / 2;
     }
 
     SDL_RenderCopy(renderer, texture, nullptr, &destRect);
-
-    SDL_DestroyTexture(texture);
-    SDL_FreeSurface(surface);
 }
 
 void RenderManager::RenderText(const std::string& text, int x, int y, TTF_Font* font, SDL_Color color, bool alignRight) {
@@ -4,6 +4,7 @@
  */
 
 #include "SaveManager.hpp"
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <cstring>
@@ -61,10 +62,20 @@ json SaveData::to_json() const {
         j["units"].push_back(unit.to_json());
     }
     
-    // Flags and variables
-    j["event_flags"] = event_flags;
-    j["variables"] = variables;
-    j["support_levels"] = support_levels;
+    // Flags and variables: handles fold back to their original strings
+    // here so the file format is unchanged and stays readable
+    j["event_flags"] = json::object();
+    for (const auto& flag : event_flags) {
+        j["event_flags"][StringInterner::Lookup(flag.first)] = flag.second;
+    }
+    j["variables"] = json::object();
+    for (const auto& variable : variables) {
+        j["variables"][StringInterner::Lookup(variable.first)] = variable.second;
+    }
+    j["support_levels"] = json::object();
+    for (const auto& support : support_levels) {
+        j["support_levels"][StringInterner::Lookup(support.first)] = support.second;
+    }
     
     // Convoy
     j["convoy"] = json::array();
@@ -76,7 +87,7 @@ json SaveData::to_json() const {
     j["unit_positions"] = json::array();
     for (const auto& pos : unit_positions) {
         j["unit_positions"].push_back({
-            {"unit_id", pos.first},
+            {"unit_id", StringInterner::Lookup(pos.first)},
             {"x", pos.second.first},
             {"y", pos.second.second}
         });
@@ -108,15 +119,24 @@ void SaveData::from_json(const json& j) {
         }
     }
     
-    // Load flags and variables
+    // Load flags and variables, interning the keys back to handles
+    event_flags.clear();
     if (j.contains("event_flags")) {
-        event_flags = j["event_flags"].get<std::map<std::string, bool>>();
+        for (auto it = j["event_flags"].begin(); it != j["event_flags"].end(); ++it) {
+            event_flags[StringInterner::Intern(it.key())] = it.value().get<bool>();
+        }
     }
+    variables.clear();
     if (j.contains("variables")) {
-        variables = j["variables"].get<std::map<std::string, int>>();
+        for (auto it = j["variables"].begin(); it != j["variables"].end(); ++it) {
+            variables[StringInterner::Intern(it.key())] = it.value().get<int>();
+        }
     }
+    support_levels.clear();
     if (j.contains("support_levels")) {
-        support_levels = j["support_levels"].get<std::map<std::string, int>>();
+        for (auto it = j["support_levels"].begin(); it != j["support_levels"].end(); ++it) {
+            support_levels[StringInterner::Intern(it.key())] = it.value().get<int>();
+        }
     }
     
     // Load convoy
@@ -136,7 +156,7 @@ void SaveData::from_json(const json& j) {
             std::string unit_id = pos["unit_id"];
             int x = pos["x"];
             int y = pos["y"];
-            unit_positions.push_back({unit_id, {x, y}});
+            unit_positions.push_back({StringInterner::Intern(unit_id), {x, y}});
         }
     }
 }
@@ -147,9 +167,9 @@ void SaveData::from_json(const json& j) {
 
 json UnitSaveData::to_json() const {
     json j;
-    j["character_id"] = character_id;
+    j["character_id"] = StringInterner::Lookup(character_id);
     j["unit_name"] = unit_name;
-    j["class_name"] = class_name;
+    j["class_name"] = StringInterner::Lookup(class_name);
     j["level"] = level;
     j["experience"] = experience;
     j["hp_current"] = hp_current;
@@ -174,9 +194,9 @@ json UnitSaveData::to_json() const {
 }
 
 void UnitSaveData::from_json(const json& j) {
-    character_id = j.value("character_id", "");
+    character_id = StringInterner::Intern(j.value("character_id", ""));
     unit_name = j.value("unit_name", "");
-    class_name = j.value("class_name", "");
+    class_name = StringInterner::Intern(j.value("class_name", ""));
     level = j.value("level", 1);
     experience = j.value("experience", 0);
     hp_current = j.value("hp_current", 20);
@@ -211,14 +231,14 @@ void UnitSaveData::from_json(const json& j) {
 
 json ItemData::to_json() const {
     json j;
-    j["item_id"] = item_id;
+    j["item_id"] = StringInterner::Lookup(item_id);
     j["uses_remaining"] = uses_remaining;
     j["is_equipped"] = is_equipped;
     return j;
 }
 
 void ItemData::from_json(const json& j) {
-    item_id = j.value("item_id", "");
+    item_id = StringInterner::Intern(j.value("item_id", ""));
     uses_remaining = j.value("uses_remaining", 0);
     is_equipped = j.value("is_equipped", false);
 }
@@ -232,6 +252,17 @@ SaveManager::SaveManager() {
 }
 
 SaveManager::~SaveManager() {
+    // Drain any in-flight async saves so a quit right after a suspend
+    // save never loses it, then stop the worker
+    {
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        if (!save_worker_.joinable()) {
+            return;
+        }
+        worker_running_ = false;
+    }
+    queue_condition_.notify_all();
+    save_worker_.join();
 }
 
 bool SaveManager::save(const SaveData& data, int slot_number, bool use_json) {
@@ -259,6 +290,77 @@ bool SaveManager::save(const SaveData& data, int slot_number, bool use_json) {
     return success;
 }
 
+void SaveManager::save_async(SaveData data, int slot_number,
+                             SaveCompleteCallback callback, bool use_json) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        start_save_worker();
+        save_queue_.push_back({std::move(data), slot_number, use_json, std::move(callback)});
+        pending_saves_++;
+    }
+    queue_condition_.notify_one();
+}
+
+void SaveManager::start_save_worker() {
+    // Caller holds queue_mutex_
+    if (save_worker_.joinable()) {
+        return;
+    }
+    worker_running_ = true;
+    save_worker_ = std::thread(&SaveManager::save_worker_loop, this);
+}
+
+void SaveManager::save_worker_loop() {
+    for (;;) {
+        SaveRequest request;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            queue_condition_.wait(lock, [this]() {
+                return !save_queue_.empty() || !worker_running_;
+            });
+            if (save_queue_.empty()) {
+                if (!worker_running_) {
+                    return;  // Shutdown with everything written
+                }
+                continue;
+            }
+            request = std::move(save_queue_.front());
+            save_queue_.pop_front();
+        }
+
+        bool success = save(request.data, request.slot_number, request.use_json);
+
+        {
+            std::lock_guard<std::mutex> lock(done_mutex_);
+            completed_saves_.push_back({request.slot_number, success,
+                                        std::move(request.callback)});
+        }
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            pending_saves_--;
+        }
+    }
+}
+
+void SaveManager::update() {
+    std::vector<CompletedSave> finished;
+    {
+        std::lock_guard<std::mutex> lock(done_mutex_);
+        finished.swap(completed_saves_);
+    }
+
+    for (auto& done : finished) {
+        if (done.callback) {
+            done.callback(done.slot_number, done.success);
+        }
+    }
+}
+
+bool SaveManager::save_pending() const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return pending_saves_ > 0;
+}
+
 bool SaveManager::load(int slot_number, SaveData& data) {
     // Try JSON first (debug format)
     std::string json_path = get_slot_path(slot_number, true);
@@ -292,6 +394,79 @@ bool SaveManager::get_slot_info(int slot_number, std::string& slot_name, time_t&
     return true;
 }
 
+bool SaveManager::peek(int slot_number, SaveHeaderInfo& info) {
+    // JSON saves are the debug format; just load them fully
+    std::string json_path = get_slot_path(slot_number, true);
+    if (fs::exists(json_path)) {
+        SaveData data;
+        if (!load_json(json_path, data)) {
+            return false;
+        }
+        info.slot_name = data.slot_name;
+        info.timestamp = data.timestamp;
+        info.current_chapter = data.current_chapter;
+        info.turn_count = data.turn_count;
+        return true;
+    }
+
+    std::string bin_path = get_slot_path(slot_number, false);
+    std::ifstream file(bin_path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    // The XOR keystream is position-based, so decrypting only the first
+    // block of the file yields valid header bytes
+    std::vector<uint8_t> buffer(1024);
+    file.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+    size_t bytes_read = static_cast<size_t>(file.gcount());
+    file.close();
+    buffer.resize(bytes_read);
+    decrypt_data(buffer);
+
+    if (bytes_read < 8) {
+        return false;
+    }
+
+    size_t offset = 0;
+    if (read_uint32(buffer.data(), offset) != MAGIC_NUMBER) {
+        std::cerr << "Invalid save file: bad magic number" << std::endl;
+        return false;
+    }
+
+    uint32_t version = read_uint32(buffer.data(), offset);
+    if (version < 2 || version > SAVE_VERSION) {
+        // Version 1 stored a JSON dump; no header to peek at
+        SaveData data;
+        if (!load_binary(bin_path, data)) {
+            return false;
+        }
+        info.slot_name = data.slot_name;
+        info.timestamp = data.timestamp;
+        info.current_chapter = data.current_chapter;
+        info.turn_count = data.turn_count;
+        return true;
+    }
+
+    // Versions 2+ lead with exactly the header fields; version 3 keeps
+    // them uncompressed ahead of the chunked payload for this reason
+    if (offset + 12 > bytes_read) {
+        return false;
+    }
+    info.timestamp = static_cast<time_t>(read_uint64(buffer.data(), offset));
+
+    uint32_t name_length = read_uint32(buffer.data(), offset);
+    if (offset + name_length + 8 > bytes_read) {
+        return false;  // Implausibly long slot name; treat as corrupt
+    }
+    info.slot_name.assign(reinterpret_cast<const char*>(buffer.data() + offset), name_length);
+    offset += name_length;
+
+    info.current_chapter = read_int32(buffer.data(), offset);
+    info.turn_count = read_int32(buffer.data(), offset);
+    return true;
+}
+
 bool SaveManager::delete_slot(int slot_number) {
     bool deleted = false;
     
@@ -411,14 +586,18 @@ bool SaveManager::save_json(const SaveData& data, const std::string& path) {
     try {
         json j = data.to_json();
         
-        std::ofstream file(path);
+        // Write to a temp file, then rename over the slot so a crash
+        // mid-write never leaves a truncated save behind
+        std::string temp_path = path + ".tmp";
+        std::ofstream file(temp_path);
         if (!file.is_open()) {
             return false;
         }
-        
+
         file << j.dump(2); // Pretty print with 2-space indent
         file.close();
-        
+
+        fs::rename(temp_path, path);
         return true;
     } catch (const std::exception& e) {
         std::cerr << "JSON save error: " << e.what() << std::endl;
@@ -449,36 +628,69 @@ bool SaveManager::load_json(const std::string& path, SaveData& data) {
 bool SaveManager::save_binary(const SaveData& data, const std::string& path) {
     try {
         std::vector<uint8_t> buffer;
-        
+
         // Write magic number
         write_uint32(buffer, MAGIC_NUMBER);
-        
+
         // Write version
         write_uint32(buffer, SAVE_VERSION);
-        
-        // Serialize data to JSON first, then convert to binary
-        json j = data.to_json();
-        std::string json_str = j.dump();
-        
-        // Write data
-        write_string(buffer, json_str);
-        
-        // Calculate and write checksum
-        uint32_t checksum = calculate_checksum(buffer);
+
+        // Uncompressed peek header: the save-select screen reads these
+        // from the first file block without touching the payload
+        write_uint64(buffer, static_cast<uint64_t>(data.timestamp));
+        write_string(buffer, data.slot_name);
+        write_int32(buffer, data.current_chapter);
+        write_int32(buffer, data.turn_count);
+
+        // Serialize with the direct binary codec, then compress the
+        // payload chunk by chunk (convoy-heavy saves are mostly
+        // repeated item records and shrink several-fold)
+        std::vector<uint8_t> payload;
+        serialize_save_data(payload, data);
+        write_uint32(buffer, static_cast<uint32_t>(payload.size()));
+        uint32_t chunk_count = static_cast<uint32_t>(
+            (payload.size() + COMPRESS_CHUNK_SIZE - 1) / COMPRESS_CHUNK_SIZE);
+        write_uint32(buffer, chunk_count);
+
+        std::vector<uint8_t> compressed;
+        for (uint32_t c = 0; c < chunk_count; c++) {
+            size_t begin = static_cast<size_t>(c) * COMPRESS_CHUNK_SIZE;
+            size_t chunk_len = std::min(COMPRESS_CHUNK_SIZE, payload.size() - begin);
+            compressed.clear();
+            size_t packed = compress_chunk(payload.data() + begin, chunk_len, compressed);
+            if (packed < chunk_len) {
+                write_uint32(buffer, static_cast<uint32_t>(packed));
+                buffer.insert(buffer.end(), compressed.begin(), compressed.end());
+            } else {
+                // Incompressible chunk: store it raw rather than grow it
+                write_uint32(buffer, static_cast<uint32_t>(chunk_len) | CHUNK_STORED_FLAG);
+                buffer.insert(buffer.end(), payload.begin() + begin,
+                              payload.begin() + begin + chunk_len);
+            }
+        }
+
+        // One fused pass: CRC32 the plaintext while encrypting it, then
+        // append the checksum encrypted with the keystream bytes at its
+        // own file position
+        uint32_t checksum = encrypt_and_crc(buffer);
+        size_t tail = buffer.size();
         write_uint32(buffer, checksum);
-        
-        // Encrypt
-        encrypt_data(buffer);
-        
-        // Write to file
-        std::ofstream file(path, std::ios::binary);
+        for (size_t i = tail; i < buffer.size(); i++) {
+            buffer[i] ^= XOR_KEY[i % sizeof(XOR_KEY)];
+        }
+
+        // Write to a temp file, then rename over the slot so a crash
+        // mid-write never leaves a truncated save behind
+        std::string temp_path = path + ".tmp";
+        std::ofstream file(temp_path, std::ios::binary);
         if (!file.is_open()) {
             return false;
         }
-        
+
         file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
         file.close();
-        
+
+        fs::rename(temp_path, path);
         return true;
     } catch (const std::exception& e) {
         std::cerr << "Binary save error: " << e.what() << std::endl;
@@ -500,10 +712,16 @@ bool SaveManager::load_binary(const std::string& path, SaveData& data) {
         std::vector<uint8_t> buffer(file_size);
         file.read(reinterpret_cast<char*>(buffer.data()), file_size);
         file.close();
-        
-        // Decrypt
-        decrypt_data(buffer);
-        
+
+        if (buffer.size() < 12) {
+            std::cerr << "Invalid save file: too small" << std::endl;
+            return false;
+        }
+
+        // Decrypt and checksum in one fused pass; the trailing 4 bytes
+        // are the stored checksum and excluded from the computation
+        uint32_t computed_crc = decrypt_and_crc(buffer, buffer.size() - 4);
+
         // Read and verify header
         size_t offset = 0;
         uint32_t magic = read_uint32(buffer.data(), offset);
@@ -511,24 +729,80 @@ bool SaveManager::load_binary(const std::string& path, SaveData& data) {
             std::cerr << "Invalid save file: bad magic number" << std::endl;
             return false;
         }
-        
+
         uint32_t version = read_uint32(buffer.data(), offset);
         if (version > SAVE_VERSION) {
             std::cerr << "Save file version too new" << std::endl;
             return false;
         }
-        
-        // Read data
-        std::string json_str = read_string(buffer.data(), offset);
-        
-        // Verify checksum
-        uint32_t stored_checksum = read_uint32(buffer.data(), offset);
-        // Note: In full implementation, recalculate and verify checksum
-        
-        // Parse JSON
-        json j = json::parse(json_str);
-        data.from_json(j);
-        
+
+        data.version = version;
+        if (version >= 3) {
+            // Verify the CRC before trusting any of the payload
+            size_t crc_offset = buffer.size() - 4;
+            uint32_t stored_crc = read_uint32(buffer.data(), crc_offset);
+            if (stored_crc != computed_crc) {
+                std::cerr << "Invalid save file: checksum mismatch" << std::endl;
+                return false;
+            }
+
+            // Skip the uncompressed peek header; the same fields repeat
+            // inside the payload
+            read_uint64(buffer.data(), offset);
+            read_string(buffer.data(), offset);
+            read_int32(buffer.data(), offset);
+            read_int32(buffer.data(), offset);
+
+            uint32_t raw_size = read_uint32(buffer.data(), offset);
+            uint32_t chunk_count = read_uint32(buffer.data(), offset);
+            std::vector<uint8_t> payload(raw_size);
+            size_t produced = 0;
+            for (uint32_t c = 0; c < chunk_count; c++) {
+                if (offset + 4 > crc_offset) {
+                    std::cerr << "Invalid save file: truncated chunk table" << std::endl;
+                    return false;
+                }
+                uint32_t stored = read_uint32(buffer.data(), offset);
+                bool stored_raw = (stored & CHUNK_STORED_FLAG) != 0;
+                size_t stored_size = stored & ~CHUNK_STORED_FLAG;
+                size_t chunk_len = std::min(COMPRESS_CHUNK_SIZE,
+                                            static_cast<size_t>(raw_size) - produced);
+                if (offset + stored_size > crc_offset) {
+                    std::cerr << "Invalid save file: truncated chunk" << std::endl;
+                    return false;
+                }
+                if (stored_raw) {
+                    if (stored_size != chunk_len) {
+                        std::cerr << "Invalid save file: bad raw chunk size" << std::endl;
+                        return false;
+                    }
+                    std::memcpy(payload.data() + produced, buffer.data() + offset, chunk_len);
+                } else if (!decompress_chunk(buffer.data() + offset, stored_size,
+                                             payload.data() + produced, chunk_len)) {
+                    std::cerr << "Invalid save file: corrupt chunk" << std::endl;
+                    return false;
+                }
+                offset += stored_size;
+                produced += chunk_len;
+            }
+            if (produced != raw_size) {
+                std::cerr << "Invalid save file: incomplete payload" << std::endl;
+                return false;
+            }
+
+            size_t payload_offset = 0;
+            deserialize_save_data(payload.data(), payload_offset, data);
+        } else if (version == 2) {
+            // Direct binary payload, uncompressed. Versions 1-2 carried
+            // an additive checksum that was never verified; skip it.
+            deserialize_save_data(buffer.data(), offset, data);
+        } else {
+            // Version 1 wrapped a JSON dump inside the binary buffer
+            std::string json_str = read_string(buffer.data(), offset);
+            json j = json::parse(json_str);
+            data.from_json(j);
+        }
+
         return true;
     } catch (const std::exception& e) {
         std::cerr << "Binary load error: " << e.what() << std::endl;
@@ -536,6 +810,193 @@ bool SaveManager::load_binary(const std::string& path, SaveData& data) {
     }
 }
 
+// ============================================================================
+// Direct binary codec (version 2 payload)
+// ============================================================================
+
+void SaveManager::write_item(std::vector<uint8_t>& buffer, const ItemData& item) {
+    write_string(buffer, StringInterner::Lookup(item.item_id));
+    write_int32(buffer, item.uses_remaining);
+    write_bool(buffer, item.is_equipped);
+}
+
+ItemData SaveManager::read_item(const uint8_t* data, size_t& offset) {
+    ItemData item;
+    item.item_id = StringInterner::Intern(read_string(data, offset));
+    item.uses_remaining = read_int32(data, offset);
+    item.is_equipped = read_bool(data, offset);
+    return item;
+}
+
+void SaveManager::write_unit(std::vector<uint8_t>& buffer, const UnitSaveData& unit) {
+    write_string(buffer, StringInterner::Lookup(unit.character_id));
+    write_string(buffer, unit.unit_name);
+    write_string(buffer, StringInterner::Lookup(unit.class_name));
+    write_int32(buffer, unit.level);
+    write_int32(buffer, unit.experience);
+    write_int32(buffer, unit.hp_current);
+    write_int32(buffer, unit.hp_max);
+    write_int32(buffer, unit.str);
+    write_int32(buffer, unit.mag);
+    write_int32(buffer, unit.skl);
+    write_int32(buffer, unit.spd);
+    write_int32(buffer, unit.lck);
+    write_int32(buffer, unit.def);
+    write_int32(buffer, unit.res);
+    write_bool(buffer, unit.is_alive);
+    write_bool(buffer, unit.is_recruited);
+
+    write_uint32(buffer, static_cast<uint32_t>(unit.status_effects.size()));
+    for (const auto& effect : unit.status_effects) {
+        write_string(buffer, effect);
+    }
+
+    write_uint32(buffer, static_cast<uint32_t>(unit.inventory.size()));
+    for (const auto& item : unit.inventory) {
+        write_item(buffer, item);
+    }
+}
+
+UnitSaveData SaveManager::read_unit(const uint8_t* data, size_t& offset) {
+    UnitSaveData unit;
+    unit.character_id = StringInterner::Intern(read_string(data, offset));
+    unit.unit_name = read_string(data, offset);
+    unit.class_name = StringInterner::Intern(read_string(data, offset));
+    unit.level = read_int32(data, offset);
+    unit.experience = read_int32(data, offset);
+    unit.hp_current = read_int32(data, offset);
+    unit.hp_max = read_int32(data, offset);
+    unit.str = read_int32(data, offset);
+    unit.mag = read_int32(data, offset);
+    unit.skl = read_int32(data, offset);
+    unit.spd = read_int32(data, offset);
+    unit.lck = read_int32(data, offset);
+    unit.def = read_int32(data, offset);
+    unit.res = read_int32(data, offset);
+    unit.is_alive = read_bool(data, offset);
+    unit.is_recruited = read_bool(data, offset);
+
+    uint32_t effect_count = read_uint32(data, offset);
+    unit.status_effects.reserve(effect_count);
+    for (uint32_t i = 0; i < effect_count; i++) {
+        unit.status_effects.push_back(read_string(data, offset));
+    }
+
+    uint32_t item_count = read_uint32(data, offset);
+    unit.inventory.reserve(item_count);
+    for (uint32_t i = 0; i < item_count; i++) {
+        unit.inventory.push_back(read_item(data, offset));
+    }
+
+    return unit;
+}
+
+void SaveManager::serialize_save_data(std::vector<uint8_t>& buffer, const SaveData& data) {
+    write_uint64(buffer, static_cast<uint64_t>(data.timestamp));
+    write_string(buffer, data.slot_name);
+    write_int32(buffer, data.current_chapter);
+    write_int32(buffer, data.turn_count);
+    write_int32(buffer, data.difficulty);
+    write_bool(buffer, data.permadeath_enabled);
+    write_bool(buffer, data.casual_mode);
+    write_int32(buffer, data.gold);
+    write_bool(buffer, data.is_mid_battle);
+    write_string(buffer, data.current_map);
+
+    write_uint32(buffer, static_cast<uint32_t>(data.units.size()));
+    for (const auto& unit : data.units) {
+        write_unit(buffer, unit);
+    }
+
+    write_uint32(buffer, static_cast<uint32_t>(data.event_flags.size()));
+    for (const auto& flag : data.event_flags) {
+        write_string(buffer, StringInterner::Lookup(flag.first));
+        write_bool(buffer, flag.second);
+    }
+
+    write_uint32(buffer, static_cast<uint32_t>(data.variables.size()));
+    for (const auto& variable : data.variables) {
+        write_string(buffer, StringInterner::Lookup(variable.first));
+        write_int32(buffer, variable.second);
+    }
+
+    write_uint32(buffer, static_cast<uint32_t>(data.support_levels.size()));
+    for (const auto& support : data.support_levels) {
+        write_string(buffer, StringInterner::Lookup(support.first));
+        write_int32(buffer, support.second);
+    }
+
+    write_uint32(buffer, static_cast<uint32_t>(data.convoy.size()));
+    for (const auto& item : data.convoy) {
+        write_item(buffer, item);
+    }
+
+    write_uint32(buffer, static_cast<uint32_t>(data.unit_positions.size()));
+    for (const auto& pos : data.unit_positions) {
+        write_string(buffer, StringInterner::Lookup(pos.first));
+        write_int32(buffer, pos.second.first);
+        write_int32(buffer, pos.second.second);
+    }
+}
+
+void SaveManager::deserialize_save_data(const uint8_t* data, size_t& offset, SaveData& out) {
+    out.timestamp = static_cast<time_t>(read_uint64(data, offset));
+    out.slot_name = read_string(data, offset);
+    out.current_chapter = read_int32(data, offset);
+    out.turn_count = read_int32(data, offset);
+    out.difficulty = read_int32(data, offset);
+    out.permadeath_enabled = read_bool(data, offset);
+    out.casual_mode = read_bool(data, offset);
+    out.gold = read_int32(data, offset);
+    out.is_mid_battle = read_bool(data, offset);
+    out.current_map = read_string(data, offset);
+
+    uint32_t unit_count = read_uint32(data, offset);
+    out.units.clear();
+    out.units.reserve(unit_count);
+    for (uint32_t i = 0; i < unit_count; i++) {
+        out.units.push_back(read_unit(data, offset));
+    }
+
+    uint32_t flag_count = read_uint32(data, offset);
+    out.event_flags.clear();
+    for (uint32_t i = 0; i < flag_count; i++) {
+        uint32_t key = StringInterner::Intern(read_string(data, offset));
+        out.event_flags[key] = read_bool(data, offset);
+    }
+
+    uint32_t variable_count = read_uint32(data, offset);
+    out.variables.clear();
+    for (uint32_t i = 0; i < variable_count; i++) {
+        uint32_t key = StringInterner::Intern(read_string(data, offset));
+        out.variables[key] = read_int32(data, offset);
+    }
+
+    uint32_t support_count = read_uint32(data, offset);
+    out.support_levels.clear();
+    for (uint32_t i = 0; i < support_count; i++) {
+        uint32_t key = StringInterner::Intern(read_string(data, offset));
+        out.support_levels[key] = read_int32(data, offset);
+    }
+
+    uint32_t convoy_count = read_uint32(data, offset);
+    out.convoy.clear();
+    out.convoy.reserve(convoy_count);
+    for (uint32_t i = 0; i < convoy_count; i++) {
+        out.convoy.push_back(read_item(data, offset));
+    }
+
+    uint32_t position_count = read_uint32(data, offset);
+    out.unit_positions.clear();
+    out.unit_positions.reserve(position_count);
+    for (uint32_t i = 0; i < position_count; i++) {
+        uint32_t unit_id = StringInterner::Intern(read_string(data, offset));
+        int x = read_int32(data, offset);
+        int y = read_int32(data, offset);
+        out.unit_positions.push_back({unit_id, {x, y}});
+    }
+}
+
 void SaveManager::encrypt_data(std::vector<uint8_t>& data) {
     // Simple XOR encryption (can be replaced with AES or similar)
     size_t key_len = sizeof(XOR_KEY);
@@ -549,14 +1010,180 @@ void SaveManager::decrypt_data(std::vector<uint8_t>& data) {
     encrypt_data(data);
 }
 
-uint32_t SaveManager::calculate_checksum(const std::vector<uint8_t>& data) {
-    // Simple checksum (can be replaced with CRC32 or similar)
-    uint32_t sum = 0;
-    for (uint8_t byte : data) {
-        sum += byte;
-        sum = (sum << 1) | (sum >> 31); // Rotate left
+// ============================================================================
+// Integrity and compression (version 3)
+// ============================================================================
+
+namespace {
+
+// CRC-32 (IEEE, reflected) slice-by-8 tables, built once on first use
+struct Crc32Tables {
+    uint32_t t[8][256];
+
+    Crc32Tables() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for (int j = 0; j < 8; j++) {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : (crc >> 1);
+            }
+            t[0][i] = crc;
+        }
+        for (int s = 1; s < 8; s++) {
+            for (uint32_t i = 0; i < 256; i++) {
+                t[s][i] = (t[s - 1][i] >> 8) ^ t[0][t[s - 1][i] & 0xFF];
+            }
+        }
+    }
+};
+
+const Crc32Tables& crc_tables() {
+    static const Crc32Tables tables;
+    return tables;
+}
+
+inline uint32_t load_le32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) |
+           (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) |
+           (static_cast<uint32_t>(p[3]) << 24);
+}
+
+// Advance the CRC state by eight bytes in one table step
+inline uint32_t crc32_step8(const Crc32Tables& tb, uint32_t crc, const uint8_t* p) {
+    uint32_t lo = load_le32(p) ^ crc;
+    uint32_t hi = load_le32(p + 4);
+    return tb.t[7][lo & 0xFF] ^ tb.t[6][(lo >> 8) & 0xFF] ^
+           tb.t[5][(lo >> 16) & 0xFF] ^ tb.t[4][lo >> 24] ^
+           tb.t[3][hi & 0xFF] ^ tb.t[2][(hi >> 8) & 0xFF] ^
+           tb.t[1][(hi >> 16) & 0xFF] ^ tb.t[0][hi >> 24];
+}
+
+} // namespace
+
+uint32_t SaveManager::encrypt_and_crc(std::vector<uint8_t>& data) {
+    const Crc32Tables& tb = crc_tables();
+    const size_t key_len = sizeof(XOR_KEY);
+    uint32_t crc = 0xFFFFFFFFu;
+    size_t i = 0;
+    const size_t aligned = data.size() & ~static_cast<size_t>(7);
+    for (; i < aligned; i += 8) {
+        // CRC the plaintext, then encrypt it, one cache-warm block at a time
+        crc = crc32_step8(tb, crc, data.data() + i);
+        for (size_t k = 0; k < 8; k++) {
+            data[i + k] ^= XOR_KEY[(i + k) % key_len];
+        }
+    }
+    for (; i < data.size(); i++) {
+        crc = (crc >> 8) ^ tb.t[0][(crc ^ data[i]) & 0xFF];
+        data[i] ^= XOR_KEY[i % key_len];
+    }
+    return ~crc;
+}
+
+uint32_t SaveManager::decrypt_and_crc(std::vector<uint8_t>& data, size_t crc_length) {
+    const Crc32Tables& tb = crc_tables();
+    const size_t key_len = sizeof(XOR_KEY);
+    uint32_t crc = 0xFFFFFFFFu;
+    size_t i = 0;
+    const size_t aligned = crc_length & ~static_cast<size_t>(7);
+    for (; i < aligned; i += 8) {
+        for (size_t k = 0; k < 8; k++) {
+            data[i + k] ^= XOR_KEY[(i + k) % key_len];
+        }
+        crc = crc32_step8(tb, crc, data.data() + i);
+    }
+    for (; i < data.size(); i++) {
+        data[i] ^= XOR_KEY[i % key_len];
+        if (i < crc_length) {
+            crc = (crc >> 8) ^ tb.t[0][(crc ^ data[i]) & 0xFF];
+        }
+    }
+    return ~crc;
+}
+
+size_t SaveManager::compress_chunk(const uint8_t* src, size_t src_len, std::vector<uint8_t>& out) {
+    // Greedy LZ over a 64K window. Ops: a control byte below 0x80 is a
+    // literal run of control+1 bytes; at or above 0x80 it is a match of
+    // (control & 0x7F) + 4 bytes at a 16-bit distance back. The repeated
+    // item and unit records that dominate big saves compress well here.
+    static const size_t MIN_MATCH = 4;
+    static const size_t MAX_MATCH = 0x7F + MIN_MATCH;
+    static const size_t MAX_DISTANCE = 0xFFFF;
+    static const uint32_t NO_POS = 0xFFFFFFFFu;
+    static const int HASH_BITS = 13;
+
+    const size_t start = out.size();
+    std::vector<uint32_t> head(1u << HASH_BITS, NO_POS);
+
+    size_t lit_start = 0;
+    auto flush_literals = [&](size_t end) {
+        while (lit_start < end) {
+            size_t run = std::min<size_t>(end - lit_start, 128);
+            out.push_back(static_cast<uint8_t>(run - 1));
+            out.insert(out.end(), src + lit_start, src + lit_start + run);
+            lit_start += run;
+        }
+    };
+
+    size_t i = 0;
+    while (i + MIN_MATCH <= src_len) {
+        uint32_t h = (load_le32(src + i) * 2654435761u) >> (32 - HASH_BITS);
+        uint32_t candidate = head[h];
+        head[h] = static_cast<uint32_t>(i);
+
+        if (candidate != NO_POS && i - candidate <= MAX_DISTANCE &&
+            std::memcmp(src + candidate, src + i, MIN_MATCH) == 0) {
+            size_t limit = std::min(src_len - i, MAX_MATCH);
+            size_t match = MIN_MATCH;
+            while (match < limit && src[candidate + match] == src[i + match]) {
+                match++;
+            }
+            flush_literals(i);
+            out.push_back(static_cast<uint8_t>(0x80 | (match - MIN_MATCH)));
+            uint16_t distance = static_cast<uint16_t>(i - candidate);
+            out.push_back(distance & 0xFF);
+            out.push_back(distance >> 8);
+            i += match;
+            lit_start = i;
+        } else {
+            i++;
+        }
     }
-    return sum;
+    flush_literals(src_len);
+    return out.size() - start;
+}
+
+bool SaveManager::decompress_chunk(const uint8_t* src, size_t src_len, uint8_t* dst, size_t dst_len) {
+    size_t in = 0;
+    size_t out = 0;
+    while (in < src_len) {
+        uint8_t control = src[in++];
+        if (control < 0x80) {
+            size_t run = static_cast<size_t>(control) + 1;
+            if (in + run > src_len || out + run > dst_len) {
+                return false;
+            }
+            std::memcpy(dst + out, src + in, run);
+            in += run;
+            out += run;
+        } else {
+            if (in + 2 > src_len) {
+                return false;
+            }
+            size_t match = static_cast<size_t>(control & 0x7F) + 4;
+            size_t distance = src[in] | (static_cast<size_t>(src[in + 1]) << 8);
+            in += 2;
+            if (distance == 0 || distance > out || out + match > dst_len) {
+                return false;
+            }
+            // Byte copy: a match may overlap its own output
+            for (size_t k = 0; k < match; k++) {
+                dst[out] = dst[out - distance];
+                out++;
+            }
+        }
+    }
+    return out == dst_len;
 }
 
 // Binary serialization helpers
@@ -580,6 +1207,11 @@ void SaveManager::write_bool(std::vector<uint8_t>& buffer, bool value) {
     buffer.push_back(value ? 1 : 0);
 }
 
+void SaveManager::write_uint64(std::vector<uint8_t>& buffer, uint64_t value) {
+    write_uint32(buffer, static_cast<uint32_t>(value & 0xFFFFFFFFu));
+    write_uint32(buffer, static_cast<uint32_t>(value >> 32));
+}
+
 uint32_t SaveManager::read_uint32(const uint8_t* data, size_t& offset) {
     uint32_t value = 0;
     value |= static_cast<uint32_t>(data[offset++]) << 0;
@@ -604,6 +1236,12 @@ bool SaveManager::read_bool(const uint8_t* data, size_t& offset) {
     return data[offset++] != 0;
 }
 
+uint64_t SaveManager::read_uint64(const uint8_t* data, size_t& offset) {
+    uint64_t low = read_uint32(data, offset);
+    uint64_t high = read_uint32(data, offset);
+    return low | (high << 32);
+}
+
 void SaveManager::ensure_save_directory() {
     std::string base_dir;
     
@@ -3,11 +3,12 @@
 #include <iomanip>
 #include <iostream>
 
-SaveSlotScreen::SaveSlotScreen(SDL_Renderer* renderer, TTF_Font* fontLarge, 
+SaveSlotScreen::SaveSlotScreen(SDL_Renderer* renderer, TTF_Font* fontLarge,
                                TTF_Font* fontMedium, TTF_Font* fontSmall,
-                               Lehran::SaveManager* saveManager)
+                               Lehran::SaveManager* saveManager,
+                               Lehran::TextCache* textCache)
     : renderer(renderer), fontLarge(fontLarge), fontMedium(fontMedium),
-      fontSmall(fontSmall), saveManager(saveManager),
+      fontSmall(fontSmall), saveManager(saveManager), textCache(textCache),
       currentMode(Mode::NEW_GAME), selectedSlot(0), 
       shouldReturn(false), selectedSlotToStart(-1),
       showingConfirmation(false), confirmationChoice(1),
@@ -37,16 +38,16 @@ void SaveSlotScreen::LoadSlotInfo() {
         slots[i].slotNumber = i;
         slots[i].hasData = false;
         
-        Lehran::SaveData data;
-        if (saveManager->load(i, data) && !data.slot_name.empty()) {
+        Lehran::SaveHeaderInfo header;
+        if (saveManager->peek(i, header) && !header.slot_name.empty()) {
             slots[i].hasData = true;
-            slots[i].characterName = data.slot_name;
-            slots[i].chapter = data.current_chapter;
+            slots[i].characterName = header.slot_name;
+            slots[i].chapter = header.current_chapter;
             // Format timestamp from time_t
             char timeStr[64];
-            strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M", localtime(&data.timestamp));
+            strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M", localtime(&header.timestamp));
             slots[i].timestamp = timeStr;
-            slots[i].playtime = data.turn_count; // Using turn_count as a proxy for playtime for now
+            slots[i].playtime = header.turn_count; // Using turn_count as a proxy for playtime for now
         } else {
             slots[i].characterName = "Empty";
             slots[i].chapter = 0;
@@ -282,32 +283,24 @@ void SaveSlotScreen::Render() {
 void SaveSlotScreen::RenderText(const std::string& text, int x, int y, TTF_Font* font, 
                                 SDL_Color color, bool centered) {
     if (!font || text.empty()) return;
-    
-    SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), color);
-    if (!surface) return;
-    
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    if (!texture) {
-        SDL_FreeSurface(surface);
-        return;
-    }
-    
+
+    int textWidth, textHeight;
+    SDL_Texture* texture = textCache->GetTexture(text, font, color, textWidth, textHeight);
+    if (!texture) return;
+
     SDL_Rect destRect;
-    destRect.w = surface->w;
-    destRect.h = surface->h;
-    
+    destRect.w = textWidth;
+    destRect.h = textHeight;
+
     if (centered) {
-        destRect.x = x - surface->w / 2;
-        destRect.y = y - surface->h / 2;
+        destRect.x = x - textWidth / 2;
+        destRect.y = y - textHeight / 2;
     } else {
         destRect.x = x;
-        destRect.y = y - surface->h / 2;
+        destRect.y = y - textHeight / 2;
     }
-    
+
     SDL_RenderCopy(renderer, texture, nullptr, &destRect);
-    
-    SDL_DestroyTexture(texture);
-    SDL_FreeSurface(surface);
 }
 
 std::string SaveSlotScreen::FormatPlaytime(int seconds) {
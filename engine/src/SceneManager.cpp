@@ -8,16 +8,25 @@ SceneManager::SceneManager(SDL_Renderer* renderer, TextureManager* textureManage
 }
 
 SceneManager::~SceneManager() {
-    // TextureManager handles cleanup of textures
+    // Unpin the background; TextureManager handles cleanup of textures
+    ClearBackground();
 }
 
 void SceneManager::SetBackground(const std::string& filePath) {
+    // The raw pointer is held across frames, so pin the cache entry to
+    // keep budget eviction from destroying it while it is on screen
+    if (!currentBackground.empty()) {
+        textureManager->ReleaseTextureRef(currentBackground);
+    }
+
     currentBackground = filePath;
     backgroundTexture = textureManager->LoadTexture(filePath);
-    
+
     if (!backgroundTexture) {
         std::cerr << "Failed to set background: " << filePath << std::endl;
+        currentBackground.clear();
     } else {
+        textureManager->AddTextureRef(currentBackground);
         std::cout << "Scene background set to: " << filePath << std::endl;
     }
 }
@@ -86,6 +95,9 @@ bool SceneManager::IsTransitionComplete() const {
 }
 
 void SceneManager::ClearBackground() {
+    if (!currentBackground.empty()) {
+        textureManager->ReleaseTextureRef(currentBackground);
+    }
     currentBackground.clear();
     backgroundTexture = nullptr;
 }
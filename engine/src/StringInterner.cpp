@@ -0,0 +1,37 @@
+#include "StringInterner.hpp"
+
+namespace Lehran {
+
+std::deque<std::string> StringInterner::strings = {""};
+std::unordered_map<std::string, uint32_t> StringInterner::handles = {{"", 0}};
+std::mutex StringInterner::mutex;
+
+uint32_t StringInterner::Intern(const std::string& value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = handles.find(value);
+    if (it != handles.end()) {
+        return it->second;
+    }
+
+    uint32_t handle = (uint32_t)strings.size();
+    strings.push_back(value);
+    handles[value] = handle;
+    return handle;
+}
+
+const std::string& StringInterner::Lookup(uint32_t handle) {
+    // The reference stays valid after the lock drops: entries are
+    // append-only and deque storage is stable
+    std::lock_guard<std::mutex> lock(mutex);
+    if (handle >= strings.size()) {
+        return strings[EMPTY];
+    }
+    return strings[handle];
+}
+
+size_t StringInterner::Count() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return strings.size();
+}
+
+} // namespace Lehran
@@ -0,0 +1,66 @@
+#include "TextCache.hpp"
+
+namespace Lehran {
+
+TextCache::TextCache(SDL_Renderer* renderer, size_t maxEntries)
+    : renderer(renderer), maxEntries(maxEntries) {
+}
+
+TextCache::~TextCache() {
+    Clear();
+}
+
+SDL_Texture* TextCache::GetTexture(const std::string& text, TTF_Font* font, SDL_Color color,
+                                   int& width, int& height) {
+    if (!font || text.empty()) return nullptr;
+
+    TextKey key = {text, font, color.r, color.g, color.b};
+
+    auto it = lookup.find(key);
+    if (it != lookup.end()) {
+        // Hit: move to the front of the LRU list
+        lruList.splice(lruList.begin(), lruList, it->second);
+        Entry& entry = lruList.front();
+        width = entry.width;
+        height = entry.height;
+        SDL_SetTextureAlphaMod(entry.texture, color.a);
+        return entry.texture;
+    }
+
+    // Miss: rasterize at full alpha (alpha is a per-draw modulation)
+    SDL_Color opaque = {color.r, color.g, color.b, 255};
+    SDL_Surface* surface = TTF_RenderText_Blended(font, text.c_str(), opaque);
+    if (!surface) return nullptr;
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    int w = surface->w;
+    int h = surface->h;
+    SDL_FreeSurface(surface);
+    if (!texture) return nullptr;
+
+    lruList.push_front({key, texture, w, h});
+    lookup[key] = lruList.begin();
+
+    // Evict the least recently used entry if over budget
+    if (lruList.size() > maxEntries) {
+        Entry& oldest = lruList.back();
+        SDL_DestroyTexture(oldest.texture);
+        lookup.erase(oldest.key);
+        lruList.pop_back();
+    }
+
+    width = w;
+    height = h;
+    SDL_SetTextureAlphaMod(texture, color.a);
+    return texture;
+}
+
+void TextCache::Clear() {
+    for (auto& entry : lruList) {
+        SDL_DestroyTexture(entry.texture);
+    }
+    lruList.clear();
+    lookup.clear();
+}
+
+} // namespace Lehran
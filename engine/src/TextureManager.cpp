@@ -1,44 +1,298 @@
 #include "TextureManager.hpp"
 #include <iostream>
 
-TextureManager::TextureManager(SDL_Renderer* renderer) 
-    : renderer(renderer) {
+TextureManager::TextureManager(SDL_Renderer* renderer)
+    : renderer(renderer), memoryBudget(0), totalBytes(0), useCounter(0) {
 }
 
 TextureManager::~TextureManager() {
     ClearCache();
 }
 
+TextureManager::AtlasPage* TextureManager::CreateAtlasPage() {
+    AtlasPage page;
+    page.surface = SDL_CreateRGBSurfaceWithFormat(0, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE,
+                                                  32, SDL_PIXELFORMAT_ARGB8888);
+    if (!page.surface) {
+        std::cerr << "Failed to create atlas surface: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+
+    // STATIC texture created once so AtlasRegion handles stay valid when
+    // later packs re-upload the page
+    page.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                     SDL_TEXTUREACCESS_STATIC,
+                                     ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+    if (!page.texture) {
+        std::cerr << "Failed to create atlas texture: " << SDL_GetError() << std::endl;
+        SDL_FreeSurface(page.surface);
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(page.texture, SDL_BLENDMODE_BLEND);
+
+    page.dirty = false;
+    page.shelfX = 0;
+    page.shelfY = 0;
+    page.shelfHeight = 0;
+
+    atlasPages.push_back(page);
+    totalBytes += (size_t)ATLAS_PAGE_SIZE * ATLAS_PAGE_SIZE * 4;
+    std::cout << "Created atlas page " << atlasPages.size() << std::endl;
+    return &atlasPages.back();
+}
+
+bool TextureManager::PackIntoPage(AtlasPage& page, SDL_Surface* surface, SDL_Rect& outSrc) {
+    int paddedW = surface->w + ATLAS_PADDING;
+    int paddedH = surface->h + ATLAS_PADDING;
+
+    // Shelf packer: fill the current row left to right, open a new row
+    // below when the image doesn't fit
+    if (page.shelfX + paddedW > ATLAS_PAGE_SIZE) {
+        page.shelfX = 0;
+        page.shelfY += page.shelfHeight;
+        page.shelfHeight = 0;
+    }
+    if (page.shelfY + paddedH > ATLAS_PAGE_SIZE) {
+        return false;  // Page full
+    }
+
+    SDL_Rect destRect = {page.shelfX, page.shelfY, surface->w, surface->h};
+    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);  // Raw pixel copy
+    SDL_BlitSurface(surface, nullptr, page.surface, &destRect);
+
+    outSrc = {page.shelfX, page.shelfY, surface->w, surface->h};
+    page.shelfX += paddedW;
+    if (paddedH > page.shelfHeight) {
+        page.shelfHeight = paddedH;
+    }
+    page.dirty = true;
+    return true;
+}
+
+TextureManager::AtlasRegion TextureManager::LoadIntoAtlas(const std::string& filePath) {
+    auto it = atlasRegions.find(filePath);
+    if (it != atlasRegions.end()) {
+        return it->second;
+    }
+
+    AtlasRegion region;
+
+    SDL_Surface* surface = TakeStreamedSurface(filePath);
+    if (!surface) {
+        surface = IMG_Load(filePath.c_str());
+    }
+    if (!surface) {
+        std::cerr << "Failed to load image " << filePath << ": " << IMG_GetError() << std::endl;
+        return region;
+    }
+
+    // Oversized images keep their own texture; the region still carries an
+    // explicit src rect so callers render both cases identically
+    if (surface->w > ATLAS_MAX_IMAGE || surface->h > ATLAS_MAX_IMAGE) {
+        region.texture = LoadTexture(filePath);
+        region.src = {0, 0, surface->w, surface->h};
+        SDL_FreeSurface(surface);
+        if (region.texture) {
+            AddTextureRef(filePath);  // Region handles outlive the frame; pin against eviction
+        }
+        atlasRegions[filePath] = region;
+        return region;
+    }
+
+    // Normalize to the page pixel format before blitting
+    SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+    SDL_FreeSurface(surface);
+    if (!converted) {
+        std::cerr << "Failed to convert surface for " << filePath << ": " << SDL_GetError() << std::endl;
+        return region;
+    }
+
+    // Pack into the last page, opening a new one when it's full
+    bool packed = false;
+    SDL_Rect src;
+    if (!atlasPages.empty()) {
+        packed = PackIntoPage(atlasPages.back(), converted, src);
+    }
+    if (!packed) {
+        AtlasPage* page = CreateAtlasPage();
+        if (page) {
+            packed = PackIntoPage(*page, converted, src);
+        }
+    }
+    SDL_FreeSurface(converted);
+
+    if (!packed) {
+        // Fall back to a standalone texture rather than failing the load
+        region.texture = LoadTexture(filePath);
+        if (region.texture) {
+            SDL_QueryTexture(region.texture, nullptr, nullptr, &region.src.w, &region.src.h);
+            AddTextureRef(filePath);  // Pin for the same reason as the oversize path
+        }
+        atlasRegions[filePath] = region;
+        return region;
+    }
+
+    region.texture = atlasPages.back().texture;
+    region.src = src;
+    atlasRegions[filePath] = region;
+    std::cout << "Packed into atlas: " << filePath << std::endl;
+    return region;
+}
+
+void TextureManager::FlushAtlasPages() {
+    for (auto& page : atlasPages) {
+        if (page.dirty) {
+            SDL_UpdateTexture(page.texture, nullptr, page.surface->pixels, page.surface->pitch);
+            page.dirty = false;
+        }
+    }
+}
+
+SDL_Surface* TextureManager::TakeStreamedSurface(const std::string& filePath) {
+    auto it = streamedSurfaces.find(filePath);
+    if (it == streamedSurfaces.end()) {
+        return nullptr;
+    }
+    SDL_Surface* surface = it->second;
+    streamedSurfaces.erase(it);
+    return surface;
+}
+
+void TextureManager::StoreStreamedSurface(const std::string& filePath, SDL_Surface* surface) {
+    if (!surface) return;
+
+    // Already loaded through the synchronous path in the meantime
+    if (textureCache.count(filePath) || atlasRegions.count(filePath) ||
+        streamedSurfaces.count(filePath)) {
+        SDL_FreeSurface(surface);
+        return;
+    }
+    streamedSurfaces[filePath] = surface;
+}
+
+int TextureManager::UploadStreamedSurfaces(int maxUploads) {
+    int uploads = 0;
+    for (auto it = streamedSurfaces.begin(); it != streamedSurfaces.end() && uploads < maxUploads;) {
+        SDL_Surface* surface = it->second;
+        if (surface->w <= ATLAS_MAX_IMAGE && surface->h <= ATLAS_MAX_IMAGE) {
+            // Atlas candidate: leave the pixels for LoadIntoAtlas
+            ++it;
+            continue;
+        }
+
+        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+        if (texture) {
+            InsertCacheEntry(it->first, texture, surface->w, surface->h);
+            std::cout << "Uploaded streamed texture: " << it->first << std::endl;
+        } else {
+            std::cerr << "Failed to create texture from " << it->first << ": " << SDL_GetError() << std::endl;
+        }
+        SDL_FreeSurface(surface);
+        it = streamedSurfaces.erase(it);
+        uploads++;
+    }
+    return uploads;
+}
+
 SDL_Texture* TextureManager::LoadTexture(const std::string& filePath) {
     // Check if already cached
     auto it = textureCache.find(filePath);
     if (it != textureCache.end()) {
-        return it->second;
+        it->second.lastUse = ++useCounter;
+        return it->second.texture;
+    }
+
+    // Use the streamed surface if the background loader already read it
+    SDL_Surface* surface = TakeStreamedSurface(filePath);
+    if (!surface) {
+        surface = IMG_Load(filePath.c_str());
     }
-    
-    // Load image surface
-    SDL_Surface* surface = IMG_Load(filePath.c_str());
     if (!surface) {
         std::cerr << "Failed to load image " << filePath << ": " << IMG_GetError() << std::endl;
         return nullptr;
     }
-    
+
     // Create texture from surface
     SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    int width = surface->w;
+    int height = surface->h;
     SDL_FreeSurface(surface);
-    
+
     if (!texture) {
         std::cerr << "Failed to create texture from " << filePath << ": " << SDL_GetError() << std::endl;
         return nullptr;
     }
-    
+
     // Cache the texture
-    textureCache[filePath] = texture;
+    InsertCacheEntry(filePath, texture, width, height);
     std::cout << "Loaded texture: " << filePath << std::endl;
-    
+
     return texture;
 }
 
+void TextureManager::InsertCacheEntry(const std::string& filePath, SDL_Texture* texture,
+                                      int width, int height) {
+    CacheEntry entry;
+    entry.texture = texture;
+    entry.bytes = (size_t)width * height * 4;
+    entry.refCount = 0;
+    entry.lastUse = ++useCounter;
+
+    totalBytes += entry.bytes;
+    textureCache[filePath] = entry;
+    EnforceBudget();
+}
+
+void TextureManager::SetMemoryBudget(size_t bytes) {
+    memoryBudget = bytes;
+    if (memoryBudget > 0) {
+        std::cout << "Texture memory budget: " << (memoryBudget / (1024 * 1024)) << " MB" << std::endl;
+    }
+    EnforceBudget();
+}
+
+void TextureManager::AddTextureRef(const std::string& filePath) {
+    auto it = textureCache.find(filePath);
+    if (it != textureCache.end()) {
+        it->second.refCount++;
+    }
+}
+
+void TextureManager::ReleaseTextureRef(const std::string& filePath) {
+    auto it = textureCache.find(filePath);
+    if (it != textureCache.end() && it->second.refCount > 0) {
+        it->second.refCount--;
+    }
+}
+
+void TextureManager::EnforceBudget() {
+    if (memoryBudget == 0) {
+        return;
+    }
+
+    // Evict least-recently-used unreferenced textures until the total
+    // fits. Pinned entries and atlas pages are never touched, so a fully
+    // pinned cache can legitimately sit over budget.
+    while (totalBytes > memoryBudget) {
+        auto victim = textureCache.end();
+        for (auto it = textureCache.begin(); it != textureCache.end(); ++it) {
+            if (it->second.refCount > 0) continue;
+            if (victim == textureCache.end() || it->second.lastUse < victim->second.lastUse) {
+                victim = it;
+            }
+        }
+        if (victim == textureCache.end()) {
+            break;
+        }
+
+        totalBytes -= victim->second.bytes;
+        SDL_DestroyTexture(victim->second.texture);
+        std::cout << "Evicted texture: " << victim->first
+                  << " (" << (victim->second.bytes / 1024) << " KB)" << std::endl;
+        textureCache.erase(victim);
+    }
+}
+
 void TextureManager::RenderTexture(SDL_Texture* texture, int x, int y, int width, int height) {
     if (!texture) return;
     
@@ -62,10 +316,25 @@ void TextureManager::RenderTexture(const std::string& filePath, int x, int y, in
     RenderTexture(texture, x, y, width, height);
 }
 
+void TextureManager::RenderAtlasRegion(const AtlasRegion& region, int x, int y, int width, int height) {
+    if (!region.IsValid()) return;
+
+    FlushAtlasPages();
+
+    SDL_Rect destRect;
+    destRect.x = x;
+    destRect.y = y;
+    destRect.w = (width == -1) ? region.src.w : width;
+    destRect.h = (height == -1) ? region.src.h : height;
+
+    SDL_RenderCopy(renderer, region.texture, &region.src, &destRect);
+}
+
 void TextureManager::UnloadTexture(const std::string& filePath) {
     auto it = textureCache.find(filePath);
     if (it != textureCache.end()) {
-        SDL_DestroyTexture(it->second);
+        totalBytes -= it->second.bytes;
+        SDL_DestroyTexture(it->second.texture);
         textureCache.erase(it);
         std::cout << "Unloaded texture: " << filePath << std::endl;
     }
@@ -73,9 +342,23 @@ void TextureManager::UnloadTexture(const std::string& filePath) {
 
 void TextureManager::ClearCache() {
     for (auto& pair : textureCache) {
-        SDL_DestroyTexture(pair.second);
+        SDL_DestroyTexture(pair.second.texture);
     }
     textureCache.clear();
+
+    for (auto& page : atlasPages) {
+        SDL_DestroyTexture(page.texture);
+        SDL_FreeSurface(page.surface);
+    }
+    atlasPages.clear();
+    atlasRegions.clear();
+
+    for (auto& pair : streamedSurfaces) {
+        SDL_FreeSurface(pair.second);
+    }
+    streamedSurfaces.clear();
+
+    totalBytes = 0;
     std::cout << "Cleared texture cache" << std::endl;
 }
 